@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Platform/PlatformMisc.h"
+#include "Misc/Compression.h"
+
+#include <cstdio>
+
+/**
+* Runs a benchmark body several times and returns the fastest run.
+* The fastest run is the one least disturbed by other processes and cold caches.
+* @param Repeats - How often the body runs.
+* @param Body - Functor with the work to measure.
+* @return Duration of the fastest run in seconds.
+*/
+template<typename FunctorType>
+double MeasureBestSeconds(int32 Repeats, FunctorType&& Body)
+{
+	double best = 0.0;
+	for (int32 i = 0; i < Repeats; ++i)
+	{
+		const double start = FPlatformMisc::Seconds();
+		Body();
+		const double duration = FPlatformMisc::Seconds() - start;
+
+		if (i == 0 || duration < best)
+			best = duration;
+	}
+
+	return best;
+}
+
+/**
+* Converts the number of bytes processed in a duration to MB/s.
+*/
+FORCEINLINE double ToMegabytesPerSecond(uint64 NumBytes, double Seconds)
+{
+	return static_cast<double>(NumBytes) / 1e6 / Seconds;
+}
+
+/**
+* Small xorshift generator, the benchmark data is the same on every run and platform.
+*/
+struct FBenchmarkRandom
+{
+	uint64 State = 0x9E3779B97F4A7C15ull;
+
+	FORCEINLINE uint32 Next()
+	{
+		State ^= State << 13;
+		State ^= State >> 7;
+		State ^= State << 17;
+		return static_cast<uint32>(State >> 32);
+	}
+
+	/** Gets a number in [0, Max). */
+	FORCEINLINE uint32 Next(uint32 Max) { return Next() % Max; }
+};
+
+/**
+* Writes a package with the game file manager's filename and reads it back through IFileManager::GetGameFileManager().
+* The package can only be loaded once per process, so raw and compressed packages are measured in separate runs.
+* @param Method - Compression of the package.
+*/
+void RunPakBenchmark(ECompressionMethod Method);
+
+/**
+* Encodes and decodes player states at full width, with varints and bit-packed, and prints the sizes and throughput.
+*/
+void RunBitArchiveBenchmark();
+
+/**
+* Saves and loads records with a hand-written operator<<, with FSerializer and as FSerializer deltas, and prints the throughput.
+*/
+void RunSerializerBenchmark();
+
+/**
+* Formats log lines with the printf style functions and with the {} placeholder functions, and prints the throughput.
+*/
+void RunFormatBenchmark();
+
+/**
+* Searches a log of several megabytes with scalar loops and with FStringSearch, and prints both durations.
+*/
+void RunStringSearchBenchmark();
\ No newline at end of file
@@ -0,0 +1,70 @@
+#define CONSOLE_APP 1
+
+#include "CoreMinimal.h"
+
+#include "App.h"
+
+#include "Platform/PlatformEntryPoint.h"
+
+#include "Misc/CommandLine.h"
+
+#include "Benchmark.h"
+
+/**
+* Runs the Core benchmarks and prints their results, see README.md for the recorded results.
+* -Benchmark=Name runs a single benchmark.
+* -PakCompression=None measures the raw package instead of the LZ4 one.
+*/
+class FBenchmarkApplication : public IApplication
+{
+	DEFAULT_APP_BODY(FBenchmarkApplication);
+
+public:
+
+	virtual void Run() override
+	{
+		FCommandLine::Value(TEXT("Benchmark"), SelectedBenchmark, ESearchCase::IgnoreCase);
+
+		if (ShouldRun(TEXT("Pak")))
+		{
+			FString compression;
+			const bool bRaw = FCommandLine::Value(TEXT("PakCompression"), compression, ESearchCase::IgnoreCase)
+				&& compression.Equals(TEXT("None"), ESearchCase::IgnoreCase);
+
+			RunPakBenchmark(bRaw ? ECompressionMethod::None : ECompressionMethod::LZ4);
+		}
+
+		if (ShouldRun(TEXT("BitArchive")))
+			RunBitArchiveBenchmark();
+
+		if (ShouldRun(TEXT("Serializer")))
+			RunSerializerBenchmark();
+
+		if (ShouldRun(TEXT("Format")))
+			RunFormatBenchmark();
+
+		if (ShouldRun(TEXT("StringSearch")))
+			RunStringSearchBenchmark();
+	}
+
+private:
+
+	bool ShouldRun(FStringView Name) const
+	{
+		return SelectedBenchmark.IsEmpty() || SelectedBenchmark.Equals(Name, ESearchCase::IgnoreCase);
+	}
+
+	/** Name of the benchmark to run, all benchmarks run if empty */
+	FString SelectedBenchmark;
+};
+
+IApplication* EntryPointGetApplication()
+{
+	FAppInfo info;
+
+	info.Name = TEXT("Benchmarks");
+	info.Description = TEXT("Impulse Engine Core benchmarks");
+	info.Version = MAKE_VERSION(1, 0, 0);
+
+	return new FBenchmarkApplication(info);
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+using Impulse;
+
+class BenchmarksModule : ModuleRules
+{
+	public BenchmarksModule()
+	{
+		ModuleType = EModuleType.Executable;
+
+		PrivateDependencyModuleNames.Add("Core");
+		PrivateDependencyModuleNames.Add("ApplicationCore");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,185 @@
+#include "Benchmark.h"
+
+#include "Serialization/Archive.h"
+#include "Serialization/BitArchive.h"
+
+namespace
+{
+	constexpr int32 NumStates = 100000;
+
+	/**
+	* Typical replicated or saved state, mostly small integers and positions in a bounded world.
+	*/
+	struct FPlayerState
+	{
+		uint32 Id = 0;
+		int32 Health = 0;
+		int32 ScoreDelta = 0;
+		float Position[3] = {};
+		float Yaw = 0.0f;
+		bool bIsAlive = false;
+		bool bIsCrouched = false;
+		TArray<uint32> Inventory;
+	};
+
+	constexpr float WorldExtent = 16384.0f;
+
+	/** Every field at full width, like a hand-written operator<< */
+	void SerializeFullWidth(FArchive& Ar, FPlayerState& State)
+	{
+		Ar << State.Id << State.Health << State.ScoreDelta;
+		Ar << State.Position[0] << State.Position[1] << State.Position[2] << State.Yaw;
+		Ar << State.bIsAlive << State.bIsCrouched;
+		Ar << State.Inventory;
+	}
+
+	/** Integers and the inventory count as varints, the rest at full width */
+	void SerializeVarints(FArchive& Ar, FPlayerState& State)
+	{
+		Ar.SerializeCompressedInt(State.Id);
+		Ar.SerializeCompressedInt(State.Health);
+		Ar.SerializeCompressedInt(State.ScoreDelta);
+		Ar << State.Position[0] << State.Position[1] << State.Position[2] << State.Yaw;
+		Ar << State.bIsAlive << State.bIsCrouched;
+
+		uint32 numItems = static_cast<uint32>(State.Inventory.Num());
+		Ar.SerializeCompressedInt(numItems);
+
+		if (Ar.IsLoading())
+			State.Inventory.SetNum(static_cast<int32>(numItems));
+
+		for (uint32& item : State.Inventory)
+			Ar.SerializeCompressedInt(item);
+	}
+
+	/** Varints, single bits for the flags and quantized floats */
+	void SerializeBitPacked(FBitArchive& Ar, FPlayerState& State)
+	{
+		Ar.SerializeCompressedInt(State.Id);
+		Ar.SerializeCompressedInt(State.Health);
+		Ar.SerializeCompressedInt(State.ScoreDelta);
+
+		for (float& coordinate : State.Position)
+			Ar.SerializeQuantizedFloat(coordinate, -WorldExtent, WorldExtent, 20);
+
+		Ar.SerializeQuantizedFloat(State.Yaw, 0.0f, 360.0f, 10);
+		Ar.SerializeBit(State.bIsAlive);
+		Ar.SerializeBit(State.bIsCrouched);
+
+		uint32 numItems = static_cast<uint32>(State.Inventory.Num());
+		Ar.SerializeInt(numItems, 16);
+
+		if (Ar.IsLoading())
+			State.Inventory.SetNum(static_cast<int32>(numItems));
+
+		for (uint32& item : State.Inventory)
+			Ar.SerializeCompressedInt(item);
+	}
+
+	TArray<FPlayerState> MakeStates()
+	{
+		FBenchmarkRandom random;
+
+		TArray<FPlayerState> states;
+		states.SetNum(NumStates);
+
+		for (int32 i = 0; i < NumStates; ++i)
+		{
+			FPlayerState& state = states[i];
+			state.Id = static_cast<uint32>(i);
+			state.Health = static_cast<int32>(random.Next(101));
+			state.ScoreDelta = static_cast<int32>(random.Next(201)) - 100;
+
+			for (float& coordinate : state.Position)
+				coordinate = static_cast<float>(random.Next(8000)) - 4000.0f + random.Next(100) * 0.01f;
+
+			state.Yaw = random.Next(3600) * 0.1f;
+			state.bIsAlive = random.Next(10) != 0;
+			state.bIsCrouched = random.Next(4) == 0;
+
+			state.Inventory.SetNum(static_cast<int32>(random.Next(9)));
+			for (uint32& item : state.Inventory)
+				item = random.Next(500);
+		}
+
+		return states;
+	}
+
+	/**
+	* Measures an encoding and prints its size and throughput.
+	* @param Name - Name of the encoding.
+	* @param States - States to encode.
+	* @param Encode - Functor encoding the states, returns the encoded bytes.
+	* @param Decode - Functor decoding the bytes into states, returns false on errors.
+	*/
+	template<typename EncodeType, typename DecodeType>
+	void MeasureEncoding(const ANSICHAR* Name, TArray<FPlayerState>& States, EncodeType&& Encode, DecodeType&& Decode)
+	{
+		TArray<uint8> data;
+		const double encodeSeconds = MeasureBestSeconds(5, [&]() { data = Encode(States); });
+
+		TArray<FPlayerState> decoded;
+		decoded.SetNum(States.Num());
+
+		bool bDecoded = false;
+		const double decodeSeconds = MeasureBestSeconds(5, [&]() { bDecoded = Decode(data, decoded); });
+
+		if (!bDecoded || decoded[States.Num() - 1].Id != States[States.Num() - 1].Id)
+		{
+			std::printf("BitArchive (%s): decoding failed\n", Name);
+			return;
+		}
+
+		std::printf("BitArchive (%s): %.1f bytes per state, encode %.1f M states/s, decode %.1f M states/s\n", Name,
+			static_cast<double>(data.Num()) / States.Num(), States.Num() / encodeSeconds / 1e6, States.Num() / decodeSeconds / 1e6);
+	}
+
+	template<void (*SerializeFunction)(FArchive&, FPlayerState&)>
+	TArray<uint8> EncodeBytes(TArray<FPlayerState>& States)
+	{
+		TArray<uint8> data;
+		FMemoryWriter writer(data);
+
+		for (FPlayerState& state : States)
+			SerializeFunction(writer, state);
+
+		return data;
+	}
+
+	template<void (*SerializeFunction)(FArchive&, FPlayerState&)>
+	bool DecodeBytes(TArray<uint8>& Data, TArray<FPlayerState>& OutStates)
+	{
+		FMemoryReader reader(Data);
+
+		for (FPlayerState& state : OutStates)
+			SerializeFunction(reader, state);
+
+		return !reader.IsError();
+	}
+}
+
+void RunBitArchiveBenchmark()
+{
+	TArray<FPlayerState> states = MakeStates();
+
+	MeasureEncoding("full width", states, EncodeBytes<SerializeFullWidth>, DecodeBytes<SerializeFullWidth>);
+	MeasureEncoding("varints", states, EncodeBytes<SerializeVarints>, DecodeBytes<SerializeVarints>);
+
+	MeasureEncoding("bit-packed", states,
+		[](TArray<FPlayerState>& States)
+		{
+			FBitWriter writer;
+			for (FPlayerState& state : States)
+				SerializeBitPacked(writer, state);
+
+			return writer.GetBuffer();
+		},
+		[](TArray<uint8>& Data, TArray<FPlayerState>& OutStates)
+		{
+			FBitReader reader(Data);
+			for (FPlayerState& state : OutStates)
+				SerializeBitPacked(reader, state);
+
+			return !reader.IsError();
+		});
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include "Benchmark.h"
+
+#include "Containers/StringBuilder.h"
+
+namespace
+{
+	constexpr int32 NumLines = 200000;
+
+	/**
+	* Arguments of a typical log line.
+	*/
+	struct FLogLineArgs
+	{
+		FString Name;
+		float X = 0.0f;
+		float Y = 0.0f;
+		int32 Health = 0;
+		int32 MaxHealth = 0;
+	};
+
+	TArray<FLogLineArgs> MakeArgs()
+	{
+		FBenchmarkRandom random;
+
+		TArray<FLogLineArgs> args;
+		args.SetNum(NumLines);
+
+		for (int32 i = 0; i < NumLines; ++i)
+		{
+			FLogLineArgs& lineArgs = args[i];
+			lineArgs.Name = FString::Format(TEXT("Actor_{}"), random.Next(10000));
+			lineArgs.X = static_cast<float>(random.Next(800000)) * 0.01f - 4000.0f;
+			lineArgs.Y = static_cast<float>(random.Next(800000)) * 0.01f - 4000.0f;
+			lineArgs.Health = static_cast<int32>(random.Next(1000));
+			lineArgs.MaxHealth = 1000;
+		}
+
+		return args;
+	}
+
+	/**
+	* Measures formatting all lines and prints the throughput.
+	* @param Name - Name of the measured path.
+	* @param FormatLine - Functor formatting a line, returns its length.
+	*/
+	template<typename FormatType>
+	void MeasureFormatting(const ANSICHAR* Name, const TArray<FLogLineArgs>& Args, FormatType&& FormatLine)
+	{
+		// The lengths are summed up, so the formatting can't be optimized away
+		uint64 numChars = 0;
+		const double seconds = MeasureBestSeconds(5, [&]()
+		{
+			numChars = 0;
+			for (const FLogLineArgs& lineArgs : Args)
+				numChars += FormatLine(lineArgs);
+		});
+
+		std::printf("Format (%s): %.2f M lines/s, %.0f ns per line, %.1f characters per line\n", Name,
+			Args.Num() / seconds / 1e6, seconds * 1e9 / Args.Num(), static_cast<double>(numChars) / Args.Num());
+	}
+}
+
+void RunFormatBenchmark()
+{
+	const TArray<FLogLineArgs> args = MakeArgs();
+
+	// %ls is a wide string for every printf implementation, %s only with the Windows wide functions
+
+	MeasureFormatting("FString::Printf", args, [](const FLogLineArgs& Args)
+	{
+		return FString::Printf(TEXT("%ls at (%.2f, %.2f) health %d of %d"), *Args.Name, Args.X, Args.Y, Args.Health, Args.MaxHealth).Length();
+	});
+
+	MeasureFormatting("FString::Format", args, [](const FLogLineArgs& Args)
+	{
+		return FString::Format(TEXT("{} at ({:.2}, {:.2}) health {} of {}"), Args.Name, Args.X, Args.Y, Args.Health, Args.MaxHealth).Length();
+	});
+
+	// Appending to a builder that is reused for every line, like a log that writes the line and resets the builder
+
+	TStringBuilder<256> builder;
+
+	MeasureFormatting("TStringBuilder::Appendf", args, [&builder](const FLogLineArgs& Args)
+	{
+		builder.Reset();
+		builder.Appendf(TEXT("%ls at (%.2f, %.2f) health %d of %d"), *Args.Name, Args.X, Args.Y, Args.Health, Args.MaxHealth);
+		return builder.Length();
+	});
+
+	MeasureFormatting("TStringBuilder::AppendFormat", args, [&builder](const FLogLineArgs& Args)
+	{
+		builder.Reset();
+		builder.AppendFormat(TEXT("{} at ({:.2}, {:.2}) health {} of {}"), Args.Name, Args.X, Args.Y, Args.Health, Args.MaxHealth);
+		return builder.Length();
+	});
+}
\ No newline at end of file
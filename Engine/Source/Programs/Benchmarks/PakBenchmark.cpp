@@ -0,0 +1,136 @@
+#include "Benchmark.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/Filesystem.h"
+#include "HAL/PackagedFileWriter.h"
+#include "Misc/Paths.h"
+#include "Math/Math.h"
+
+#include <cmath>
+
+namespace
+{
+	constexpr int32 NumFiles = 48;
+	constexpr int32 FileSize = 1 << 20;
+	constexpr int32 NumPartialReads = 20000;
+	constexpr int32 PartialReadSize = 4096;
+
+	FString GetAssetPath(int32 Index)
+	{
+		return FString::Format(TEXT("Assets/Asset{}.bin"), Index);
+	}
+
+	/**
+	* Creates the asset mix of the benchmark package, a third each of:
+	* - Text, like configs and scripts
+	* - Float vertex data, which partially repeats
+	* - Random bytes, like already compressed textures and audio
+	*/
+	TArray<uint8> MakeAsset(int32 Index, FBenchmarkRandom& Random)
+	{
+		static const ANSICHAR* const words[] = { "Actor", "Transform", "Location", "Rotation", "Scale", "Material", "Texture", "true",
+			"false", "=", "\n", "[Section]", "Name", "Value", "0.5", "1.0" };
+
+		TArray<uint8> data;
+		data.SetNumUninitialized(FileSize);
+
+		switch (Index % 3)
+		{
+		case 0:
+		{
+			int32 pos = 0;
+			while (pos < FileSize)
+			{
+				for (const ANSICHAR* word = words[Random.Next(16)]; *word && pos < FileSize; ++word)
+					data[pos++] = static_cast<uint8>(*word);
+
+				if (pos < FileSize)
+					data[pos++] = ' ';
+			}
+			break;
+		}
+		case 1:
+		{
+			float* vertices = reinterpret_cast<float*>(data.GetData());
+			for (int32 i = 0; i < FileSize / 4; ++i)
+			{
+				if (i % 8 < 3)
+					vertices[i] = FMath::Round(std::sin(i * 0.001f) * 1000.0f) / 1000.0f;
+				else
+					vertices[i] = i % 8 < 6 ? (i % 97) * 0.25f : 1.0f;
+			}
+			break;
+		}
+		default:
+			for (int32 i = 0; i < FileSize; ++i)
+				data[i] = static_cast<uint8>(Random.Next());
+			break;
+		}
+
+		return data;
+	}
+}
+
+void RunPakBenchmark(ECompressionMethod Method)
+{
+#if IE_PACKAGED_BUILD
+
+	FBenchmarkRandom random;
+
+	FPackagedFileWriter writer;
+	if (Method != ECompressionMethod::None)
+		writer.SetCompression(Method);
+
+	for (int32 i = 0; i < NumFiles; ++i)
+		writer.AddFile(GetAssetPath(i), MakeAsset(i, random));
+
+	const FString packageFilename = FPaths::Combine(FPaths::GameRootDir(), TEXT(IE_PACKAGED_FILES_FILENAME));
+	const uint64 totalSize = static_cast<uint64>(NumFiles) * FileSize;
+
+	bool bWritten = false;
+	const double writeSeconds = MeasureBestSeconds(1, [&]() { bWritten = writer.Write(packageFilename); });
+
+	if (!bWritten)
+	{
+		std::printf("Pak: failed to write the package\n");
+		return;
+	}
+
+	const FFileHandle package = FFilesystem::OpenFile(packageFilename, FILE_Read);
+	const uint64 packageSize = FFilesystem::GetFileSize(package);
+	FFilesystem::CloseFile(package);
+
+	IFileManager& fileManager = IFileManager::GetGameFileManager();
+	TArray<uint8> fileData;
+
+	const double fullReadSeconds = MeasureBestSeconds(5, [&]()
+	{
+		for (int32 i = 0; i < NumFiles; ++i)
+			fileManager.ReadBytes(GetAssetPath(i), fileData);
+	});
+
+	const double partialReadSeconds = MeasureBestSeconds(3, [&]()
+	{
+		FBenchmarkRandom readRandom;
+		for (int32 i = 0; i < NumPartialReads; ++i)
+		{
+			FReadFileOptions options;
+			options.Offset = readRandom.Next(FileSize - PartialReadSize);
+			options.MaxBytesToRead = PartialReadSize;
+			fileManager.ReadBytes(GetAssetPath(readRandom.Next(NumFiles)), fileData, options);
+		}
+	});
+
+	std::printf("Pak (%s): ratio %.3f, build %.0f MB/s, full reads %.0f MB/s, 4 KiB random reads %.0f MB/s\n",
+		Method == ECompressionMethod::None ? "raw" : "LZ4",
+		static_cast<double>(packageSize) / totalSize,
+		ToMegabytesPerSecond(totalSize, writeSeconds),
+		ToMegabytesPerSecond(totalSize, fullReadSeconds),
+		ToMegabytesPerSecond(static_cast<uint64>(NumPartialReads) * PartialReadSize, partialReadSeconds));
+
+#else
+
+	std::printf("Pak: needs a build with IE_PACKAGED_BUILD\n");
+
+#endif
+}
\ No newline at end of file
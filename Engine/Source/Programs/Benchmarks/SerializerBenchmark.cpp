@@ -0,0 +1,136 @@
+#include "Benchmark.h"
+
+#include "Serialization/Serializer.h"
+
+namespace
+{
+	constexpr int32 NumRecords = 100000;
+
+	/**
+	* Record of a saved game, a name, a few numbers and a small array.
+	*/
+	struct FSaveRecord
+	{
+		FString Name;
+		int32 Level = 0;
+		int32 Health = 0;
+		float X = 0.0f;
+		float Y = 0.0f;
+		float Z = 0.0f;
+		TArray<int32> Inventory;
+
+		friend FArchive& operator<<(FArchive& Ar, FSaveRecord& Value)
+		{
+			return Ar << Value.Name << Value.Level << Value.Health << Value.X << Value.Y << Value.Z << Value.Inventory;
+		}
+	};
+}
+
+template<>
+struct TSerializerSchema<FSaveRecord>
+{
+	static constexpr uint32 Version = 1;
+
+	using Fields = TSerializerFields<
+		TSerializerField<1, &FSaveRecord::Name>,
+		TSerializerField<2, &FSaveRecord::Level>,
+		TSerializerField<3, &FSaveRecord::Health>,
+		TSerializerField<4, &FSaveRecord::X>,
+		TSerializerField<5, &FSaveRecord::Y>,
+		TSerializerField<6, &FSaveRecord::Z>,
+		TSerializerField<7, &FSaveRecord::Inventory>>;
+};
+
+namespace
+{
+	TArray<FSaveRecord> MakeRecords()
+	{
+		FBenchmarkRandom random;
+
+		TArray<FSaveRecord> records;
+		records.SetNum(NumRecords);
+
+		for (int32 i = 0; i < NumRecords; ++i)
+		{
+			FSaveRecord& record = records[i];
+			record.Name = FString::Format(TEXT("Actor_{}"), i);
+			record.Level = static_cast<int32>(random.Next(60));
+			record.Health = static_cast<int32>(random.Next(1000));
+			record.X = static_cast<float>(random.Next(8000)) - 4000.0f;
+			record.Y = static_cast<float>(random.Next(8000)) - 4000.0f;
+			record.Z = static_cast<float>(random.Next(500));
+
+			record.Inventory.SetNum(static_cast<int32>(random.Next(9)));
+			for (int32& item : record.Inventory)
+				item = static_cast<int32>(random.Next(500));
+		}
+
+		return records;
+	}
+
+	/**
+	* Measures saving and loading all records and prints the size and throughput.
+	* @param Name - Name of the measured path.
+	* @param Save - Functor saving a record to an archive.
+	* @param Load - Functor loading a record from an archive.
+	*/
+	template<typename SaveType, typename LoadType>
+	void MeasureSerialization(const ANSICHAR* Name, TArray<FSaveRecord>& Records, SaveType&& Save, LoadType&& Load)
+	{
+		TArray<uint8> data;
+		const double saveSeconds = MeasureBestSeconds(5, [&]()
+		{
+			data.Empty();
+			FMemoryWriter writer(data);
+
+			for (FSaveRecord& record : Records)
+				Save(writer, record);
+		});
+
+		TArray<FSaveRecord> loaded;
+		loaded.SetNum(Records.Num());
+
+		bool bLoaded = false;
+		const double loadSeconds = MeasureBestSeconds(5, [&]()
+		{
+			FMemoryReader reader(data);
+
+			for (int32 i = 0; i < loaded.Num(); ++i)
+				Load(reader, loaded[i], Records[i]);
+
+			bLoaded = !reader.IsError();
+		});
+
+		if (!bLoaded || !FSerializer::Identical(loaded[loaded.Num() - 1], Records[Records.Num() - 1]))
+		{
+			std::printf("Serializer (%s): loading failed\n", Name);
+			return;
+		}
+
+		std::printf("Serializer (%s): %.1f bytes per struct, save %.2f M structs/s, load %.2f M structs/s\n", Name,
+			static_cast<double>(data.Num()) / Records.Num(), Records.Num() / saveSeconds / 1e6, Records.Num() / loadSeconds / 1e6);
+	}
+}
+
+void RunSerializerBenchmark()
+{
+	TArray<FSaveRecord> records = MakeRecords();
+
+	MeasureSerialization("operator<<", records,
+		[](FArchive& Ar, FSaveRecord& Record) { Ar << Record; },
+		[](FArchive& Ar, FSaveRecord& OutRecord, const FSaveRecord&) { Ar << OutRecord; });
+
+	MeasureSerialization("FSerializer", records,
+		[](FArchive& Ar, FSaveRecord& Record) { FSerializer::Save(Ar, Record); },
+		[](FArchive& Ar, FSaveRecord& OutRecord, const FSaveRecord&) { FSerializer::Load(Ar, OutRecord); });
+
+	// Deltas against a baseline with a different health, like state that changed since the last save
+
+	TArray<FSaveRecord> baselines = records;
+	for (FSaveRecord& baseline : baselines)
+		baseline.Health += 1;
+
+	MeasureSerialization("FSerializer delta", records,
+		[&baselines, &records](FArchive& Ar, FSaveRecord& Record) { FSerializer::SaveDelta(Ar, Record, baselines[static_cast<int32>(&Record - records.GetData())]); },
+		[&baselines, &records](FArchive& Ar, FSaveRecord& OutRecord, const FSaveRecord& Record) { FSerializer::LoadDelta(Ar, OutRecord, baselines[static_cast<int32>(&Record - records.GetData())]); });
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+#include "Benchmark.h"
+
+#include "Containers/StringBuilder.h"
+#include "Misc/StringSearch.h"
+
+namespace
+{
+	constexpr int32 LogLength = 8 * 1024 * 1024;
+
+	/**
+	* Creates a log of about LogLength characters, lines like the ones the engine writes.
+	*/
+	FString MakeLog()
+	{
+		static const TCHAR* const categories[] = { TEXT("LogStreaming"), TEXT("LogNet"), TEXT("LogRender"), TEXT("LogAudio") };
+		static const TCHAR* const verbosities[] = { TEXT("Display"), TEXT("Log"), TEXT("Verbose"), TEXT("Warning") };
+
+		FBenchmarkRandom random;
+
+		TStringBuilder<256> builder;
+		while (builder.Length() < LogLength)
+		{
+			builder.AppendFormat(TEXT("[2026.10.19-13:{:02}:{:02}:{:03}][{:3}]{}: {}: Loaded package /Game/Maps/Level_{} in {:.2} ms\r\n"),
+				random.Next(60), random.Next(60), random.Next(1000), random.Next(1000),
+				categories[random.Next(4)], verbosities[random.Next(4)], random.Next(100), random.Next(10000) * 0.01f);
+		}
+
+		return builder.ToString();
+	}
+
+	// Compares at every index, how substrings were searched before FStringSearch
+	int32 FindScalar(FStringView Log, FStringView SubStr, ESearchCase SearchCase)
+	{
+		for (int32 i = 0; i <= Log.Length() - SubStr.Length(); ++i)
+		{
+			if (FPlatformString::Compare(Log.GetData() + i, SubStr.GetData(), SubStr.Length(), SearchCase))
+				return i;
+		}
+
+		return INDEX_NONE;
+	}
+
+	template<typename FindType>
+	int32 CountMatches(FStringView Log, FindType&& Find)
+	{
+		int32 count = 0;
+		for (int32 i = 0; i < Log.Length(); ++count)
+		{
+			const int32 found = Find(Log.GetData() + i, Log.Length() - i);
+			if (found == INDEX_NONE)
+				break;
+
+			i += found + 1;
+		}
+
+		return count;
+	}
+
+	/**
+	* Measures a scalar loop and the FStringSearch primitive doing the same search and prints both.
+	* @param Name - Name of the search.
+	* @param Scalar - Functor with the scalar loop, returns its result.
+	* @param Vectorized - Functor with the FStringSearch primitive, returns the same result.
+	*/
+	template<typename ScalarType, typename VectorizedType>
+	void MeasureSearch(const ANSICHAR* Name, uint64 NumBytes, ScalarType&& Scalar, VectorizedType&& Vectorized)
+	{
+		int32 scalarResult = 0;
+		int32 vectorizedResult = 0;
+
+		const double scalarSeconds = MeasureBestSeconds(5, [&]() { scalarResult = Scalar(); });
+		const double vectorizedSeconds = MeasureBestSeconds(5, [&]() { vectorizedResult = Vectorized(); });
+
+		if (scalarResult != vectorizedResult)
+		{
+			std::printf("StringSearch (%s): results differ, %d and %d\n", Name, scalarResult, vectorizedResult);
+			return;
+		}
+
+		std::printf("StringSearch (%s): scalar %.2f ms (%.0f MB/s), FStringSearch %.2f ms (%.0f MB/s), %.1fx\n", Name,
+			scalarSeconds * 1e3, ToMegabytesPerSecond(NumBytes, scalarSeconds),
+			vectorizedSeconds * 1e3, ToMegabytesPerSecond(NumBytes, vectorizedSeconds), scalarSeconds / vectorizedSeconds);
+	}
+}
+
+void RunStringSearchBenchmark()
+{
+	const FString logString = MakeLog();
+	const FStringView log = logString;
+	const uint64 numBytes = static_cast<uint64>(log.Length()) * sizeof(TCHAR);
+
+	// Needles that aren't in the log, so the whole buffer is searched
+
+	const FStringView missing = TEXT("Fatal error: out of video memory");
+	const FStringView missingIgnoreCase = TEXT("loaded package /game/maps/level_100");
+
+	MeasureSearch("Find", numBytes,
+		[&]() { return FindScalar(log, missing, ESearchCase::CaseSensitive); },
+		[&]() { return log.Find(missing); });
+
+	MeasureSearch("Find ignoring case", numBytes,
+		[&]() { return FindScalar(log, missingIgnoreCase, ESearchCase::IgnoreCase); },
+		[&]() { return log.Find(missingIgnoreCase, ESearchCase::IgnoreCase); });
+
+	MeasureSearch("count lines", numBytes,
+		[&]()
+		{
+			return CountMatches(log, [](const TCHAR* Data, int32 Length) -> int32
+			{
+				for (int32 i = 0; i < Length; ++i)
+				{
+					if (Data[i] == TEXT('\n'))
+						return i;
+				}
+
+				return INDEX_NONE;
+			});
+		},
+		[&]() { return CountMatches(log, [](const TCHAR* Data, int32 Length) { return FStringSearch::FindChar(Data, Length, TEXT('\n')); }); });
+
+	// Delimiters of a tokenizer, only the brackets around the time and thread of each line are in the log
+
+	static const TCHAR delimiters[] = { TEXT('['), TEXT(']'), TEXT('"'), TEXT(';') };
+
+	MeasureSearch("FindFirstOf", numBytes,
+		[&]()
+		{
+			return CountMatches(log, [](const TCHAR* Data, int32 Length) -> int32
+			{
+				for (int32 i = 0; i < Length; ++i)
+				{
+					for (const TCHAR delimiter : delimiters)
+					{
+						if (Data[i] == delimiter)
+							return i;
+					}
+				}
+
+				return INDEX_NONE;
+			});
+		},
+		[&]() { return CountMatches(log, [](const TCHAR* Data, int32 Length) { return FStringSearch::FindFirstOf(Data, Length, delimiters, 4); }); });
+
+	MeasureSearch("Strlen", numBytes,
+		[&]()
+		{
+			const TCHAR* data = *logString;
+
+			int32 length = 0;
+			while (data[length])
+				++length;
+
+			return length;
+		},
+		[&]() { return FStringSearch::Strlen(*logString); });
+}
\ No newline at end of file
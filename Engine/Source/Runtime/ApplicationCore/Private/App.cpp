@@ -1,5 +1,7 @@
 #include "App.h"
 
+#include "Environment.h"
+
 volatile bool FApp::s_bInitialized = false;
 FDelegateHandle FApp::s_RequestExitDelegateHandle;
 FAppCommandsArgs FApp::s_CommandLineArgs;
@@ -23,6 +25,8 @@ void FApp::Init()
 	FCommandLine::Init();
 	s_CommandLineArgs.Init(FCommandLine::GetAsArray());
 
+	GEnvironment.Init();
+
 	// Initialization successful
 
 	s_bInitialized = true;
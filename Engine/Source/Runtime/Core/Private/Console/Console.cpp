@@ -1,6 +1,6 @@
 #include "Console/Console.h"
 
-#include "Misc/Parse.h"
+#include "Misc/Tokenizer.h"
 
 TArray<IConsole*> FConsoleRegistry::s_Consoles;
 
@@ -92,7 +92,7 @@ void IConsoleVariable::Execute(const TArray<FString>& Arguments)
 	if (Arguments.Num() >= 2)
 		SetValueFromString(Arguments[1]);
 	else
-		Console->PrintLine(FString::Printf(TEXT("%s = %s"), *Name, *GetValueAsString()));
+		Console->PrintLine(FString::Format(TEXT("{} = {}"), Name, GetValueAsString()));
 }
 
 IConsole::IConsole()
@@ -111,53 +111,65 @@ bool IConsole::ExecuteCommand(const FString& Command)
 
 	PrintLine(Command);
 
-	// Find a command with the name of the first token
+	// Find a command with the name of the first token, the arguments are only copied for an existing command
 
-	TArray<FString> tokens;
-	if (!FParse::Tokenize(Command, tokens, false, false, ' '))
+	FTokenizer tokenizer(Command, false, false, TEXT(' '), TEXT('\"'), TEXT('\\'));
+	if (!tokenizer.Next())
 		return false;
 
-	if (tokens.Num() == 0)
-		return false;
-
-	IConsoleCommand* command = FindCommand(tokens[0]);
+	IConsoleCommand* command = FindCommand(tokenizer.GetToken());
 	if (!command)
 		return false;
 
-	command->Execute(tokens);
+	TArray<FString> arguments;
+	do
+	{
+		arguments.Add(FString(tokenizer.GetToken()));
+	} while (tokenizer.Next());
+
+	command->Execute(arguments);
 	return true;
 }
 
-IConsoleCommand* IConsole::FindCommand(const FString& Name) const
+IConsoleCommand* IConsole::FindCommand(FStringView Name) const
 {
-	IConsoleCommand* const* commandPtr = Commands.Find(Name);
+	// A name that was never interned can't be the name of a command
+	const FInternedString name = FInternedString::FindAnyCasing(Name);
+	if (name.IsEmpty())
+		return nullptr;
+
+	IConsoleCommand* const* commandPtr = Commands.Find(name);
 	return commandPtr ? *commandPtr : nullptr;
 }
 
-int32 IConsole::FindCommands(const FString& Name, TArray<IConsoleCommand*>& OutCommands) const
+int32 IConsole::FindCommands(FStringView Name, TArray<IConsoleCommand*>& OutCommands) const
 {
 	OutCommands.Empty();
 	for (const auto& Command : Commands)
 	{
-		if (Command.GetKey().Contains(Name, ESearchCase::IgnoreCase))
+		if (Command.GetKey().ToView().Contains(Name, ESearchCase::IgnoreCase))
 			OutCommands.Add(Command.GetValue());
 	}
 
 	return OutCommands.Num();
 }
 
-IConsoleVariable* IConsole::FindVariable(const FString& Name) const
+IConsoleVariable* IConsole::FindVariable(FStringView Name) const
 {
-	IConsoleVariable* const* variablePtr = Variables.Find(Name);
+	const FInternedString name = FInternedString::FindAnyCasing(Name);
+	if (name.IsEmpty())
+		return nullptr;
+
+	IConsoleVariable* const* variablePtr = Variables.Find(name);
 	return variablePtr ? *variablePtr : nullptr;
 }
 
-int32 IConsole::FindVariables(const FString& Name, TArray<IConsoleVariable*>& OutVariables) const
+int32 IConsole::FindVariables(FStringView Name, TArray<IConsoleVariable*>& OutVariables) const
 {
 	OutVariables.Empty();
 	for (const auto& Variable : Variables)
 	{
-		if (Variable.GetKey().Contains(Name, ESearchCase::IgnoreCase))
+		if (Variable.GetKey().ToView().Contains(Name, ESearchCase::IgnoreCase))
 			OutVariables.Add(Variable.GetValue());
 	}
 
@@ -0,0 +1,211 @@
+#include "Containers/InternedString.h"
+
+#include "Misc/ScopeLock.h"
+#include "Misc/StringSearch.h"
+
+namespace
+{
+	// The low bits of the hash pick the shard, the bits above them the slot in the shard's table
+	constexpr uint32 ShardBits = 4;
+	constexpr uint32 NumShards = 1 << ShardBits;
+
+	constexpr uint32 MinTableCapacity = 64;
+
+	// Entries are packed into chunks, bigger entries get an allocation of their own
+	constexpr int32 ChunkSize = 64 * 1024;
+	constexpr int32 MaxChunkEntrySize = ChunkSize / 4;
+
+	enum class EFindMode : uint8
+	{
+		FindOrAdd,
+
+		// Only the exact characters
+		FindOnly,
+
+		// The characters in any casing
+		FindAnyCasing,
+	};
+
+	/**
+	* Part of the pool, a hash table of entry pointers with linear probing.
+	* Every casing of a string has the same hash, so all of them are found in the same probe sequence.
+	*/
+	class FInternedStringShard
+	{
+	public:
+
+		FInternedStringShard() = default;
+		FInternedStringShard(const FInternedStringShard&) = delete;
+		FInternedStringShard& operator=(const FInternedStringShard&) = delete;
+
+		const FInternedStringEntry* Find(FStringView InString, uint32 InHash, EFindMode InFindMode)
+		{
+			FScopeLock lock(&m_CriticalSection);
+
+			const FInternedStringEntry* comparison = nullptr;
+			if (m_Capacity > 0)
+			{
+				const uint32 mask = m_Capacity - 1;
+				for (uint32 index = (InHash >> ShardBits) & mask; m_Table[index]; index = (index + 1) & mask)
+				{
+					const FInternedStringEntry* entry = m_Table[index];
+					if (entry->Hash != InHash || entry->Length != InString.Length())
+						continue;
+
+					if (FMemory::Memcmp(entry->Chars, InString.GetData(), InString.Length() * sizeof(TCHAR)) == 0)
+						return entry;
+
+					// Only ASCII letters ignore case, like the hash
+					if (!comparison && FStringSearch::EqualsIgnoreCaseAscii(entry->Chars, InString.GetData(), InString.Length()))
+						comparison = entry->Comparison;
+				}
+			}
+
+			if (InFindMode == EFindMode::FindOnly)
+				return nullptr;
+
+			// Another casing compares equal, so it's as good as the string itself for lookups
+			if (InFindMode == EFindMode::FindAnyCasing)
+				return comparison;
+
+			if ((m_Num + 1) * 2 > m_Capacity)
+				Grow();
+
+			FInternedStringEntry* entry = AllocateEntry(InString.Length());
+			entry->Comparison = comparison ? comparison : entry;
+			entry->Hash = InHash;
+			entry->Length = InString.Length();
+			FMemory::Memcpy(entry->Chars, InString.GetData(), InString.Length() * sizeof(TCHAR));
+			entry->Chars[InString.Length()] = 0;
+
+			Insert(entry);
+			m_Num++;
+
+			return entry;
+		}
+
+		int32 Num()
+		{
+			FScopeLock lock(&m_CriticalSection);
+			return static_cast<int32>(m_Num);
+		}
+
+	private:
+
+		FInternedStringEntry* AllocateEntry(int32 InLength)
+		{
+			constexpr size_t alignment = alignof(FInternedStringEntry);
+			const size_t size = (offsetof(FInternedStringEntry, Chars) + (InLength + 1) * sizeof(TCHAR) + alignment - 1) & ~(alignment - 1);
+
+			if (size > MaxChunkEntrySize)
+				return static_cast<FInternedStringEntry*>(FMemory::Malloc(size));
+
+			if (size > m_ChunkRemaining)
+			{
+				m_Chunk = static_cast<uint8*>(FMemory::Malloc(ChunkSize));
+				m_ChunkRemaining = ChunkSize;
+			}
+
+			FInternedStringEntry* entry = reinterpret_cast<FInternedStringEntry*>(m_Chunk);
+			m_Chunk += size;
+			m_ChunkRemaining -= size;
+
+			return entry;
+		}
+
+		void Insert(const FInternedStringEntry* InEntry)
+		{
+			const uint32 mask = m_Capacity - 1;
+
+			uint32 index = (InEntry->Hash >> ShardBits) & mask;
+			while (m_Table[index])
+				index = (index + 1) & mask;
+
+			m_Table[index] = InEntry;
+		}
+
+		// Doubles the table, keeps it at most half full so probe sequences stay short
+		void Grow()
+		{
+			const FInternedStringEntry** oldTable = m_Table;
+			const uint32 oldCapacity = m_Capacity;
+
+			m_Capacity = oldCapacity > 0 ? oldCapacity * 2 : MinTableCapacity;
+			m_Table = static_cast<const FInternedStringEntry**>(FMemory::Malloc(m_Capacity * sizeof(FInternedStringEntry*)));
+			FMemory::Memset(m_Table, 0, m_Capacity * sizeof(FInternedStringEntry*));
+
+			for (uint32 i = 0; i < oldCapacity; i++)
+			{
+				if (oldTable[i])
+					Insert(oldTable[i]);
+			}
+
+			if (oldTable)
+				FMemory::Free(oldTable);
+		}
+
+		FCriticalSection m_CriticalSection;
+
+		const FInternedStringEntry** m_Table = nullptr;
+		uint32 m_Capacity = 0;
+		uint32 m_Num = 0;
+
+		uint8* m_Chunk = nullptr;
+		size_t m_ChunkRemaining = 0;
+	};
+
+	// Constructed on first use, names may be interned during static initialization
+	FInternedStringShard* GetShards()
+	{
+		static FInternedStringShard shards[NumShards];
+		return shards;
+	}
+
+	const FInternedStringEntry* FindEntry(FStringView InString, EFindMode InFindMode)
+	{
+		if (InString.IsEmpty())
+			return nullptr;
+
+		const uint32 hash = GetTypeHash(InString.GetData(), InString.Length());
+		return GetShards()[hash & (NumShards - 1)].Find(InString, hash, InFindMode);
+	}
+
+	FORCEINLINE EFindMode ToFindMode(ENameSearchMode InSearchMode)
+	{
+		return InSearchMode == ENameSearchMode::FindOnly ? EFindMode::FindOnly : EFindMode::FindOrAdd;
+	}
+}
+
+FInternedString::FInternedString(const TCHAR* InString, ENameSearchMode InSearchMode)
+	: m_Entry(FindEntry(FStringView(InString), ToFindMode(InSearchMode)))
+{
+}
+
+FInternedString::FInternedString(FStringView InString, ENameSearchMode InSearchMode)
+	: m_Entry(FindEntry(InString, ToFindMode(InSearchMode)))
+{
+}
+
+FInternedString::FInternedString(const FString& InString, ENameSearchMode InSearchMode)
+	: m_Entry(FindEntry(InString, ToFindMode(InSearchMode)))
+{
+}
+
+FInternedString FInternedString::FindAnyCasing(FStringView InString)
+{
+	FInternedString result;
+	result.m_Entry = FindEntry(InString, EFindMode::FindAnyCasing);
+
+	return result;
+}
+
+int32 FInternedString::GetNumInterned()
+{
+	FInternedStringShard* shards = GetShards();
+
+	int32 num = 0;
+	for (uint32 i = 0; i < NumShards; i++)
+		num += shards[i].Num();
+
+	return num;
+}
\ No newline at end of file
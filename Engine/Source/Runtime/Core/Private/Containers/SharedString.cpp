@@ -0,0 +1,81 @@
+#include "Containers/SharedString.h"
+
+FSharedString::FSharedString(const TCHAR* InString)
+	: FSharedString(FStringView(InString))
+{
+}
+
+FSharedString::FSharedString(FStringView InString)
+{
+	// An empty string has no buffer, so default and empty strings don't allocate
+	if (InString.IsEmpty())
+		return;
+
+	const size_t size = offsetof(FBuffer, Chars) + (InString.Length() + 1) * sizeof(TCHAR);
+
+	m_Buffer = static_cast<FBuffer*>(FMemory::Malloc(size));
+	m_Buffer->RefCount = 1;
+
+	FMemory::Memcpy(m_Buffer->Chars, InString.GetData(), InString.Length() * sizeof(TCHAR));
+	m_Buffer->Chars[InString.Length()] = 0;
+
+	m_Data = m_Buffer->Chars;
+	m_Length = InString.Length();
+}
+
+FSharedString::FSharedString(const FString& InString)
+	: FSharedString(FStringView(InString))
+{
+}
+
+FSharedString& FSharedString::operator=(const FSharedString& Other)
+{
+	// Add the reference first, the other string may share the buffer
+	Other.AddRef();
+	Release();
+
+	m_Buffer = Other.m_Buffer;
+	m_Data = Other.m_Data;
+	m_Length = Other.m_Length;
+
+	return *this;
+}
+
+FSharedString& FSharedString::operator=(FSharedString&& Other) noexcept
+{
+	if (this != &Other)
+	{
+		Release();
+
+		m_Buffer = Other.m_Buffer;
+		m_Data = Other.m_Data;
+		m_Length = Other.m_Length;
+
+		Other.m_Buffer = nullptr;
+		Other.m_Data = nullptr;
+		Other.m_Length = 0;
+	}
+
+	return *this;
+}
+
+bool FSharedString::IsShared() const
+{
+	return m_Buffer && FPlatformAtomics::AtomicRead(&m_Buffer->RefCount) > 1;
+}
+
+FSharedString FSharedString::SubString(FStringView InView) const
+{
+	FSharedString result;
+	if (InView.IsEmpty())
+		return result;
+
+	checkf(InView.GetData() >= m_Data && InView.GetData() + InView.Length() <= m_Data + m_Length, TEXT("The view isn't part of the string."));
+
+	result.m_Buffer = m_Buffer;
+	result.m_Data = InView.GetData();
+	result.m_Length = InView.Length();
+	result.AddRef();
+
+	return result;
+}
\ No newline at end of file
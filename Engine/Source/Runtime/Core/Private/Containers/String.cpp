@@ -1,4 +1,5 @@
 #include "Containers/ImpulseString.h"
+#include "Containers/StringBuilder.h"
 
 FString FString::DefaultTrimChars = TEXT(" \t\r\n\v\f");
 
@@ -16,6 +17,11 @@ FString::FString(const TCHAR* InData)
 	Copy(InData, m_Length);
 }
 
+FString::FString(FStringView InView)
+{
+	Copy(InView.GetData(), InView.Length());
+}
+
 FString& FString::operator=(FString&& Other) noexcept
 {
 	m_Data = MoveTemp(Other.m_Data);
@@ -99,95 +105,67 @@ FString FString::Mid(int32 InStartIndex, int32 InLength) const
 	return result;
 }
 
-int32 FString::Find(const FString& InSubStr, ESearchCase InSearchCase, ESearchDir InSearchDir, int32 InStartIndex) const
+int32 FString::Find(FStringView InSubStr, ESearchCase InSearchCase, ESearchDir InSearchDir, int32 InStartIndex) const
 {
-	const int32 subStrLength = InSubStr.Length();
-	if (subStrLength == 0)
-		return INDEX_NONE;
-
-	const TCHAR* subStr = *InSubStr;
-
-	if (InSearchDir == ESearchDir::FromStart)
-		return FindForward(subStr, subStrLength, InStartIndex, InSearchCase);
-	else
-		return FindBackward(subStr, subStrLength, InStartIndex, InSearchCase);
+	return FStringView(*this).Find(InSubStr, InSearchCase, InSearchDir, InStartIndex);
 }
 
-TArray<int32> FString::FindAll(const FString& InSubStr, ESearchCase InSearchCase, ESearchDir InSearchDir, int32 InStartIndex) const
+TArray<int32> FString::FindAll(FStringView InSubStr, ESearchCase InSearchCase, ESearchDir InSearchDir, int32 InStartIndex) const
 {
 	TArray<int32> result;
 
+	const FStringView view = *this;
 	const int32 subStrLength = InSubStr.Length();
-	if (subStrLength == 0)
-		return result;
 
-	const TCHAR* subStr = *InSubStr;
-
-	if (InSearchDir == ESearchDir::FromStart)
+	int32 index = view.Find(InSubStr, InSearchCase, InSearchDir, InStartIndex);
+	while (index != INDEX_NONE)
 	{
-		int32 index = FindForward(subStr, subStrLength, InStartIndex, InSearchCase);
-		while (index != INDEX_NONE)
-		{
-			result.Add(index);
-			index = FindForward(subStr, subStrLength, index + subStrLength, InSearchCase);
-		}
-	}
-	else
-	{
-		int32 index = FindBackward(subStr, subStrLength, InStartIndex, InSearchCase);
-		while (index != INDEX_NONE)
-		{
-			result.Add(index);
-			index = FindBackward(subStr, subStrLength, m_Length - index + subStrLength, InSearchCase);
-		}
+		result.Add(index);
+
+		// Continue after the occurrence, or before it when searching backwards, occurrences don't overlap in either direction
+		const int32 nextStartIndex = InSearchDir == ESearchDir::FromStart ? index + subStrLength : m_Length - index;
+		index = view.Find(InSubStr, InSearchCase, InSearchDir, nextStartIndex);
 	}
 
 	return result;
 }
 
-bool FString::Contains(const FString& InSubStr, ESearchCase InSearchCase) const
+bool FString::Contains(FStringView InSubStr, ESearchCase InSearchCase) const
 {
 	return Find(InSubStr, InSearchCase) != INDEX_NONE;
 }
 
 bool FString::ContainsChar(TCHAR InChar, ESearchCase InSearchCase) const
 {
-	for (int32 i = 0; i < m_Length; ++i)
-	{
-		if (FPlatformString::Compare(&m_Data[i], &InChar, 1, InSearchCase))
-			return true;
-	}
+	if (InSearchCase == ESearchCase::CaseSensitive)
+		return FStringView(*this).FindChar(InChar) != INDEX_NONE;
+
+	TCHAR chars[3];
+	const int32 numChars = FCaseFolding::GetCaseVariants(InChar, chars);
+	if (numChars == 0)
+		return FStringView(*this).Find(FStringView(&InChar, 1), ESearchCase::IgnoreCase) != INDEX_NONE;
 
-	return false;
+	return FStringSearch::FindFirstOf(m_Data.GetData(), m_Length, chars, numChars) != INDEX_NONE;
 }
 
-bool FString::StartsWith(const FString& InSubStr, ESearchCase InSearchCase) const
+bool FString::StartsWith(FStringView InSubStr, ESearchCase InSearchCase) const
 {
-	if (InSubStr.Length() > m_Length)
-		return false;
-
-	return FPlatformString::Compare(m_Data.GetData(), *InSubStr, InSubStr.Length(), InSearchCase);
+	return FStringView(*this).StartsWith(InSubStr, InSearchCase);
 }
 
-bool FString::EndsWith(const FString& InSubStr, ESearchCase InSearchCase) const
+bool FString::EndsWith(FStringView InSubStr, ESearchCase InSearchCase) const
 {
-	if (InSubStr.Length() > m_Length)
-		return false;
-
-	return FPlatformString::Compare(m_Data.GetData() + (m_Length - InSubStr.Length()), *InSubStr, InSubStr.Length(), InSearchCase);
+	return FStringView(*this).EndsWith(InSubStr, InSearchCase);
 }
 
-bool FString::Equals(const FString& InOther, ESearchCase InSearchCase) const
+bool FString::Equals(FStringView InOther, ESearchCase InSearchCase) const
 {
-	if (m_Length != InOther.Length())
-		return false;
-
-	return FPlatformString::Compare(m_Data.GetData(), *InOther, m_Length, InSearchCase);
+	return FStringView(*this).Equals(InOther, InSearchCase);
 }
 
 bool FString::IsEmpty() const
 {
-	return m_Data.Num() == 0;
+	return m_Length == 0;
 }
 
 void FString::Empty()
@@ -209,88 +187,28 @@ bool FString::IsWhiteSpace() const
 
 void FString::InlineTrimStart(const TCHAR* InTrimChars)
 {
-	int32 trimCharsLength = 0;
-	if (InTrimChars)
-		trimCharsLength = FPlatformString::Strlen(InTrimChars);
-	else
-	{
-		InTrimChars = *DefaultTrimChars;
-		trimCharsLength = DefaultTrimChars.Length();
-	}
-
-	for (int32 i = 0; i < m_Length; ++i)
-	{
-		bool found = false;
-		for (int32 j = 0; j < trimCharsLength; ++j)
-		{
-			if (m_Data[i] == InTrimChars[j])
-			{
-				found = true;
-				break;
-			}
-		}
-
-		if (!found)
-		{
-			// We found the first non-trim char, so we can stop here
-			// and copy the rest of the string
-
-			if (i == 0)
-				return;
-
-			const int32 newLength = m_Length - i;
-			FMemory::Memmove(m_Data.GetData(), &m_Data[i], newLength * sizeof(TCHAR));
+	const int32 newLength = FStringView(*this).TrimStart(InTrimChars ? InTrimChars : *DefaultTrimChars).Length();
+	if (newLength == m_Length)
+		return;
 
-			m_Data[newLength] = 0;
-			m_Length = newLength;
+	FMemory::Memmove(m_Data.GetData(), &m_Data[m_Length - newLength], newLength * sizeof(TCHAR));
 
-			Allocate(m_Length);
+	m_Data[newLength] = 0;
+	m_Length = newLength;
 
-			return;
-		}
-	}
+	Allocate(m_Length);
 }
 
 void FString::InlineTrimEnd(const TCHAR* InTrimChars)
 {
-	int32 trimCharsLength = 0;
-	if (InTrimChars)
-		trimCharsLength = FPlatformString::Strlen(InTrimChars);
-	else
-	{
-		InTrimChars = *DefaultTrimChars;
-		trimCharsLength = DefaultTrimChars.Length();
-	}
-
-	for (int32 i = m_Length - 1; i >= 0; --i)
-	{
-		bool found = false;
-		for (int32 j = 0; j < trimCharsLength; ++j)
-		{
-			if (m_Data[i] == InTrimChars[j])
-			{
-				found = true;
-				break;
-			}
-		}
-
-		if (!found)
-		{
-			// We found the first non-trim char, so we can stop here
-			// and copy the rest of the string
-
-			if (i == m_Length - 1)
-				return;
-
-			const int32 newLength = i + 1;
-			m_Data[newLength] = 0;
-			m_Length = newLength;
+	const int32 newLength = FStringView(*this).TrimEnd(InTrimChars ? InTrimChars : *DefaultTrimChars).Length();
+	if (newLength == m_Length)
+		return;
 
-			Allocate(m_Length);
+	m_Data[newLength] = 0;
+	m_Length = newLength;
 
-			return;
-		}
-	}
+	Allocate(m_Length);
 }
 
 void FString::InlineTrim(const TCHAR* InTrimChars)
@@ -375,67 +293,18 @@ void FString::Copy(const TCHAR* InData, int32 InNum)
 	m_Length = InNum;
 }
 
-int32 FString::FindForward(const TCHAR* InSubStr, int32 InSubStrLength, int32 InStartIndex, ESearchCase SearchCase) const
-{
-	const int32 len = m_Length - InSubStrLength;
-	for (int32 i = InStartIndex; i < len; ++i)
-	{
-		if (FPlatformString::Compare(&m_Data.GetData()[i], InSubStr, InSubStrLength, SearchCase))
-			return i;
-	}
-
-	return INDEX_NONE;
-}
-
-int32 FString::FindBackward(const TCHAR* InSubStr, int32 InSubStrLength, int32 InStartIndex, ESearchCase SearchCase) const
-{
-	const int32 start = m_Length - InStartIndex;
-	for (int32 i = start; i >= 0; --i)
-	{
-		if (FPlatformString::Compare(&m_Data.GetData()[i], InSubStr, InSubStrLength, SearchCase))
-			return i;
-	}
-
-	return INDEX_NONE;
-}
-
 FString FString::Printf(const TCHAR* InFormat, ...)
 {
-	TCHAR stringBuffer[STRING_PRINTF_BUFFER_SIZE];
-	TCHAR* buffer = stringBuffer;
+	// Formats straight into the builder, short strings never touch the heap until the result is copied
 
-	int32 resultCode = -1;
-	int32 bufferSize = STRING_PRINTF_BUFFER_SIZE;
+	TStringBuilder<STRING_PRINTF_BUFFER_SIZE> builder;
 
 	va_list args;
 	va_start(args, InFormat);
-
-	resultCode = FPlatformString::Vsnprintf(buffer, bufferSize, InFormat, args);
-
-	// If resultCode is -1, it means that the buffer was too small
-	// So we increase the buffer until it's big enough
-
-	if (resultCode == -1)
-	{
-		buffer = nullptr;
-		while (resultCode == -1);
-		{
-			bufferSize *= 2;
-			buffer = (TCHAR*)FMemory::Realloc(buffer, bufferSize * sizeof(TCHAR));
-
-			resultCode = FPlatformString::Vsnprintf(buffer, bufferSize, InFormat, args);
-		}
-	}
-
+	builder.AppendfV(InFormat, args);
 	va_end(args);
 
-	buffer[resultCode] = 0;
-	FString result(buffer);
-
-	if (bufferSize != STRING_PRINTF_BUFFER_SIZE)
-		FMemory::Free(buffer);
-
-	return result;
+	return builder.ToString();
 }
 
 bool FString::ToInt8Save(int8& OutValue) const
@@ -634,72 +503,142 @@ FString FString::FromUInt64(uint64 InValue)
 
 FString FString::FromFloat(float InValue, int32 MinFractionalDigits)
 {
-	TCHAR buffer[64];
-	FPlatformString::FromFloating<float>(InValue, buffer, 64, MinFractionalDigits);
+	TCHAR buffer[FLOAT_STRING_BUFFER_SIZE];
+	FPlatformString::FromFloating<float>(InValue, buffer, FLOAT_STRING_BUFFER_SIZE, MinFractionalDigits);
 
 	return FString(buffer);
 }
 
 FString FString::FromDouble(double InValue, int32 MinFractionalDigits)
 {
-	TCHAR buffer[64];
-	FPlatformString::FromFloating<double>(InValue, buffer, 64, MinFractionalDigits);
+	TCHAR buffer[FLOAT_STRING_BUFFER_SIZE];
+	FPlatformString::FromFloating<double>(InValue, buffer, FLOAT_STRING_BUFFER_SIZE, MinFractionalDigits);
 
 	return FString(buffer);
 }
 
-FArchive& operator<<(FArchive& Ar, FString& Value)
+namespace
 {
+	/** Strings are saved in chunks of this many characters when they are narrowed to one byte per character. */
+	constexpr int32 StringSerializeChunkSize = 256;
+
+	// Applies the archive string encryption to a character, the encryption is its own inverse
+	template<typename CharType>
+	FORCEINLINE CharType EncryptArchiveChar(CharType Char)
+	{
 #if ENCRYPT_ARCHIVE_STRING
+		return static_cast<CharType>(~Char);
+#else
+		return Char;
+#endif
+	}
+}
+
+FArchive& operator<<(FArchive& Ar, FString& Value)
+{
+	// The length is followed by the characters.
+	// A negative length means one byte per character, used if all characters fit, a positive length means TCHARs.
 
 	if (Ar.IsSaving())
 	{
-		// Before serializing the string, we need to encrypt it
+		const TCHAR* data = Value.m_Data.GetData();
 
-		FString copy = Value;
-		for (int32 i = 0; i < copy.Length(); ++i)
-			copy[i] = ~copy[i];
+		bool bNarrow = true;
+		for (int32 i = 0; i < Value.m_Length && bNarrow; ++i)
+			bNarrow = static_cast<uint32>(data[i]) <= 0xFF;
 
-		Ar << copy.m_Length;
-		Ar.Serialize(copy.m_Data.GetData(), copy.m_Length * sizeof(TCHAR));
-	}
-	else
-	{
-		int32 length = 0;
-		Ar << length;
+		int32 saveNum = bNarrow ? -Value.m_Length : Value.m_Length;
+		Ar << saveNum;
 
-		Value.Allocate(length);
-		Ar.Serialize(Value.m_Data.GetData(), length * sizeof(TCHAR));
+		if (bNarrow)
+		{
+			uint8 chunk[StringSerializeChunkSize];
 
-		Value.m_Length = length;
-		Value.m_Data[length] = 0;
+			for (int32 start = 0; start < Value.m_Length; start += StringSerializeChunkSize)
+			{
+				const int32 num = FMath::Min(StringSerializeChunkSize, Value.m_Length - start);
+				for (int32 i = 0; i < num; ++i)
+					chunk[i] = EncryptArchiveChar(static_cast<uint8>(data[start + i]));
 
-		// After serializing the string, we need to decrypt it
+				Ar.Serialize(chunk, num);
+			}
+		}
+		else
+		{
+#if ENCRYPT_ARCHIVE_STRING
+			TCHAR chunk[StringSerializeChunkSize];
 
-		for (int32 i = 0; i < Value.Length(); ++i)
-			Value[i] = ~Value[i];
-	}
+			for (int32 start = 0; start < Value.m_Length; start += StringSerializeChunkSize)
+			{
+				const int32 num = FMath::Min(StringSerializeChunkSize, Value.m_Length - start);
+				for (int32 i = 0; i < num; ++i)
+					chunk[i] = EncryptArchiveChar(data[start + i]);
 
+				Ar.Serialize(chunk, num * sizeof(TCHAR));
+			}
 #else
-
-	if (Ar.IsSaving())
-	{
-		Ar << Value.m_Length;
-		Ar.Serialize(Value.m_Data.GetData(), Value.m_Length * sizeof(TCHAR));
+			Ar.Serialize(Value.m_Data.GetData(), Value.m_Length * sizeof(TCHAR));
+#endif
+		}
 	}
 	else
 	{
-		int32 length = 0;
-		Ar << length;
+		int32 saveNum = 0;
+		Ar << saveNum;
+
+		const bool bNarrow = saveNum < 0;
+		const int32 length = bNarrow ? (saveNum == MIN_int32 ? -1 : -saveNum) : saveNum;
+		const uint64 charSize = bNarrow ? 1 : sizeof(TCHAR);
+
+		// Validate the length before allocating, it comes from the data
+
+		const uint64 remaining = Ar.TotalSize() > Ar.Tell() ? Ar.TotalSize() - Ar.Tell() : 0;
+
+		if (Ar.IsError() || length < 0 || static_cast<uint64>(length) * charSize > remaining)
+		{
+			Ar.SetError();
+			Value.Empty();
+
+			return Ar;
+		}
 
 		Value.Allocate(length);
-		Ar.Serialize(Value.m_Data.GetData(), length * sizeof(TCHAR));
+		TCHAR* data = Value.m_Data.GetData();
 
-		Value.m_Length = length;
-		Value.m_Data[length] = 0;
-	}
+		if (bNarrow)
+		{
+			// Read the bytes into the front of the string and widen them back to front, so no temporary buffer is needed.
+			// Memory archives hand out the bytes directly.
+
+			const uint8* bytes = Ar.SerializeView(static_cast<uint64>(length));
+			if (!bytes)
+			{
+				Ar.Serialize(data, static_cast<uint64>(length));
+				bytes = reinterpret_cast<const uint8*>(data);
+			}
+
+			for (int32 i = length - 1; i >= 0; --i)
+				data[i] = static_cast<TCHAR>(EncryptArchiveChar(bytes[i]));
+		}
+		else
+		{
+			Ar.Serialize(data, static_cast<uint64>(length) * sizeof(TCHAR));
 
+#if ENCRYPT_ARCHIVE_STRING
+			for (int32 i = 0; i < length; ++i)
+				data[i] = EncryptArchiveChar(data[i]);
 #endif
+		}
+
+		if (Ar.IsError())
+		{
+			Value.Empty();
+			return Ar;
+		}
+
+		Value.m_Length = length;
+		data[length] = 0;
+	}
 
 	return Ar;
 }
\ No newline at end of file
@@ -1,26 +1,44 @@
 #include "Containers/Variant.h"
 
-FVariant::FVariant(const FVariant& Other)
+namespace
 {
-	if (Other.Data)
+	/** Size in bytes of the scalar value of each variant type, 0 for non-scalar types. */
+	constexpr uint8 ScalarSizes[EVariantType::Count] =
 	{
-		Type = Other.Type;
-		Data = Other.Data->MakeCopy();
-	}
+		0,					// Unknown
+		sizeof(bool),		// Bool
+		sizeof(int8),		// Int8
+		sizeof(int16),		// Int16
+		sizeof(int32),		// Int32
+		sizeof(int64),		// Int64
+		sizeof(uint8),		// UInt8
+		sizeof(uint16),		// UInt16
+		sizeof(uint32),		// UInt32
+		sizeof(uint64),		// UInt64
+		sizeof(float),		// Float
+		sizeof(double),		// Double
+		0,					// String
+	};
+}
+
+FVariant::FVariant(const FVariant& Other)
+{
+	CopyFrom(Other);
 }
 
 FVariant::FVariant(FVariant&& Other) noexcept
 {
-	Data = Other.Data;
-	Type = Other.Type;
+	MoveFrom(Other);
+}
 
-	Other.Data = nullptr;
-	Other.Type = EVariantType::Unknown;
+FVariant::FVariant(const TCHAR* InString)
+{
+	SetString(InString, InString ? TPlatformString<TCHAR>::Strlen(InString) : 0);
 }
 
 FVariant::~FVariant()
 {
-	FreeData();
+	Empty();
 }
 
 FVariant& FVariant::operator=(const FVariant& Other)
@@ -28,13 +46,8 @@ FVariant& FVariant::operator=(const FVariant& Other)
 	if (this == &Other)
 		return *this;
 
-	FreeData();
-
-	if (Other.Data)
-	{
-		Data = Other.Data->MakeCopy();
-		Type = Other.Type;
-	}
+	Empty();
+	CopyFrom(Other);
 
 	return *this;
 }
@@ -44,24 +57,196 @@ FVariant& FVariant::operator=(FVariant&& Other) noexcept
 	if (this == &Other)
 		return *this;
 
-	FreeData();
+	Empty();
+	MoveFrom(Other);
 
-	Data = Other.Data;
-	Type = Other.Type;
+	return *this;
+}
 
-	Other.Data = nullptr;
-	Other.Type = EVariantType::Unknown;
+FVariant& FVariant::operator=(const TCHAR* InString)
+{
+	// The string might point into this variant, so copy it before releasing the old value
 
-	return *this;
+	FVariant copy(InString);
+	return *this = MoveTemp(copy);
 }
 
-void FVariant::FreeData()
+const TCHAR* FVariant::GetString() const
 {
-	if (Data)
+	checkf(Type == EVariantType::String, TEXT("Invalid type"));
+	return bInlineString ? Value.InlineString : *GetHeapString();
+}
+
+int32 FVariant::GetStringLength() const
+{
+	checkf(Type == EVariantType::String, TEXT("Invalid type"));
+	return bInlineString ? InlineStringLength : GetHeapString().Length();
+}
+
+void FVariant::Empty()
+{
+	if (Type == EVariantType::String && !bInlineString)
+		DestructItem<FString>(&GetHeapString());
+
+	Type = EVariantType::Unknown;
+	bInlineString = false;
+	InlineStringLength = 0;
+}
+
+void FVariant::SetString(const TCHAR* InString, int32 InLength)
+{
+	TCHAR* data = InitString(InLength);
+	if (InLength > 0)
+		FMemory::Memcpy(data, InString, InLength * sizeof(TCHAR));
+}
+
+TCHAR* FVariant::InitString(int32 InLength)
+{
+	Type = EVariantType::String;
+
+	if (InLength <= InlineStringCapacity)
 	{
-		delete Data;
-		Data = nullptr;
+		Value.InlineString[InLength] = 0;
 
-		Type = EVariantType::Unknown;
+		bInlineString = true;
+		InlineStringLength = static_cast<uint8>(InLength);
+
+		return Value.InlineString;
 	}
+
+	FString* string = new (Value.HeapString.Bytes) FString();
+	string->Allocate(InLength);
+
+	string->m_Data[InLength] = 0;
+	string->m_Length = InLength;
+
+	bInlineString = false;
+
+	return string->m_Data.GetData();
+}
+
+void FVariant::CopyFrom(const FVariant& Other)
+{
+	switch (Other.Type)
+	{
+	case EVariantType::Unknown:
+		break;
+	case EVariantType::String:
+		if (Other.bInlineString)
+			SetString(Other.Value.InlineString, Other.InlineStringLength);
+		else
+			SetString(*Other.GetHeapString(), Other.GetHeapString().Length());
+		break;
+	default:
+		Value = Other.Value;
+		Type = Other.Type;
+		break;
+	}
+}
+
+void FVariant::MoveFrom(FVariant& Other)
+{
+	switch (Other.Type)
+	{
+	case EVariantType::Unknown:
+		break;
+	case EVariantType::String:
+		if (Other.bInlineString)
+		{
+			Value = Other.Value;
+			InlineStringLength = Other.InlineStringLength;
+			bInlineString = true;
+		}
+		else
+		{
+			new (Value.HeapString.Bytes) FString(MoveTemp(Other.GetHeapString()));
+			bInlineString = false;
+		}
+
+		Type = EVariantType::String;
+		break;
+	default:
+		Value = Other.Value;
+		Type = Other.Type;
+		break;
+	}
+
+	Other.Empty();
+}
+
+FArchive& operator<<(FArchive& Ar, FVariant& Variant)
+{
+	// Strings use the FString format, so they get its narrow encoding and its length checks
+
+	if (Ar.IsSaving())
+	{
+		uint8 type = Variant.Type;
+		Ar << type;
+
+		if (Variant.Type == EVariantType::String)
+		{
+			if (Variant.bInlineString)
+			{
+				FString string(FStringView(Variant.Value.InlineString, Variant.InlineStringLength));
+				Ar << string;
+			}
+			else
+			{
+				Ar << Variant.GetHeapString();
+			}
+		}
+		else if (ScalarSizes[Variant.Type] > 0)
+		{
+			Ar.Serialize(&Variant.Value, ScalarSizes[Variant.Type]);
+		}
+	}
+	else
+	{
+		Variant.Empty();
+
+		uint8 type = EVariantType::Unknown;
+		Ar << type;
+
+		if (Ar.IsError())
+			return Ar;
+
+		if (type >= EVariantType::Count)
+		{
+			Ar.SetError();
+			return Ar;
+		}
+
+		if (type == EVariantType::String)
+		{
+			FString string;
+			Ar << string;
+
+			if (Ar.IsError())
+				return Ar;
+
+			// Long strings keep the loaded allocation
+
+			if (string.Length() <= FVariant::InlineStringCapacity)
+			{
+				Variant.SetString(*string, string.Length());
+			}
+			else
+			{
+				new (Variant.Value.HeapString.Bytes) FString(MoveTemp(string));
+
+				Variant.Type = EVariantType::String;
+				Variant.bInlineString = false;
+			}
+		}
+		else if (ScalarSizes[type] > 0)
+		{
+			Ar.Serialize(&Variant.Value, ScalarSizes[type]);
+			Variant.Type = static_cast<EVariantType::Type>(type);
+		}
+
+		if (Ar.IsError())
+			Variant.Empty();
+	}
+
+	return Ar;
 }
\ No newline at end of file
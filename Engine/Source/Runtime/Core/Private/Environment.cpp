@@ -1,11 +1,10 @@
 #include "Environment.h"
 
-#include "Misc/Parse.h"
 #include "Misc/CommandLine.h"
 
 FEnvironment GEnvironment;
 
-FEnvironment::FEnvironment()
+void FEnvironment::Init()
 {
-	bIsSingleThreaded = FParse::Param(FCommandLine::Get(), TEXT("singlethreaded"));
+	bIsSingleThreaded = FCommandLine::Param(TEXT("singlethreaded"));
 }
\ No newline at end of file
@@ -0,0 +1,373 @@
+#include "HAL/AsyncFileIO.h"
+
+#include "Memory/Memory.h"
+
+FAsyncIORequest::FAsyncIORequest(FFileHandle InHandle, uint64 InOffset, uint64 InSize, EAsyncIOPriority InPriority)
+	: Handle(InHandle)
+	, Offset(InOffset)
+	, Size(InSize)
+	, Priority(InPriority)
+	, DoneEvent(true)
+{
+}
+
+bool FAsyncIORequest::Cancel()
+{
+	if (!TransitionStatus(EAsyncIOStatus::Pending, EAsyncIOStatus::Cancelled))
+		return false;
+
+	// The request stays queued and is dropped when a worker thread reaches it
+
+	InvokeCallback();
+	DoneEvent.Trigger();
+
+	return true;
+}
+
+bool FAsyncIORequest::WaitForCompletion(uint32 WaitTime)
+{
+	return DoneEvent.Wait(WaitTime);
+}
+
+bool FAsyncIORequest::TransitionStatus(EAsyncIOStatus From, EAsyncIOStatus To)
+{
+	const FAtomic from = static_cast<FAtomic>(From);
+	return FPlatformAtomics::InterlockedCompareExchange(&Status, static_cast<FAtomic>(To), from) == from;
+}
+
+void FAsyncIORequest::Complete(EAsyncIOStatus FinalStatus, uint64 InBytesTransferred)
+{
+	BytesTransferred = InBytesTransferred;
+	FPlatformAtomics::InterlockedExchange(&Status, static_cast<FAtomic>(FinalStatus));
+
+	InvokeCallback();
+	DoneEvent.Trigger();
+}
+
+FAsyncReadRequest::FAsyncReadRequest(FFileHandle InHandle, uint64 InOffset, uint64 InSize, uint8* InBuffer, EAsyncIOPriority InPriority, FCallback&& InCallback)
+	: FAsyncIORequest(InHandle, InOffset, InSize, InPriority)
+	, Buffer(InBuffer)
+	, Callback(MoveTemp(InCallback))
+{
+	if (!Buffer)
+	{
+		checkf(InSize <= static_cast<uint64>(MAX_int32), TEXT("Reads of more than 2 GiB need a caller provided buffer."));
+		OwnedBuffer.SetNumUninitialized(static_cast<int32>(InSize));
+	}
+}
+
+void FAsyncReadRequest::InvokeCallback()
+{
+	if (Callback)
+		Callback(*this);
+}
+
+FAsyncWriteRequest::FAsyncWriteRequest(FFileHandle InHandle, uint64 InOffset, uint64 InSize, const uint8* InData, EAsyncIOPriority InPriority, FCallback&& InCallback)
+	: FAsyncIORequest(InHandle, InOffset, InSize, InPriority)
+	, Data(InData)
+	, Callback(MoveTemp(InCallback))
+{
+}
+
+void FAsyncWriteRequest::InvokeCallback()
+{
+	if (Callback)
+		Callback(*this);
+}
+
+FAsyncFileIO::~FAsyncFileIO()
+{
+	Shutdown();
+}
+
+FAsyncFileIO& FAsyncFileIO::Get()
+{
+	static FAsyncFileIO AsyncFileIO;
+	return AsyncFileIO;
+}
+
+void FAsyncFileIO::Startup(int32 NumWorkers)
+{
+	FScopeLock lock(&QueueCriticalSection);
+
+	bStopping = false;
+	StartWorkers(NumWorkers);
+}
+
+void FAsyncFileIO::Shutdown()
+{
+	TArray<FAsyncIORequestPtr> pendingRequests;
+	TArray<FThread> workers;
+
+	{
+		FScopeLock lock(&QueueCriticalSection);
+
+		bStopping = true;
+
+		for (FRequestQueue& queue : Queues)
+		{
+			for (int32 i = queue.Head; i < queue.Requests.Num(); ++i)
+			{
+				if (queue.Requests[i])
+					pendingRequests.Add(queue.Requests[i]);
+			}
+
+			queue.Requests.Empty();
+			queue.Head = 0;
+		}
+
+		workers = MoveTemp(Workers);
+		Workers.Empty();
+
+		WorkEvent.Trigger();
+	}
+
+	// Callbacks must not run under the lock, they may queue new requests
+
+	for (int32 i = 0; i < pendingRequests.Num(); ++i)
+		pendingRequests[i]->Cancel();
+
+	for (int32 i = 0; i < workers.Num(); ++i)
+		FPlatformThread::WaitForThread(workers[i].ThreadHandle);
+}
+
+FAsyncReadRequestPtr FAsyncFileIO::Read(FFileHandle Handle, uint64 Offset, uint64 Size, uint8* Buffer, EAsyncIOPriority Priority, FAsyncReadRequest::FCallback&& Callback)
+{
+	FAsyncReadRequestPtr request(new FAsyncReadRequest(Handle, Offset, Size, Buffer, Priority, MoveTemp(Callback)));
+	Enqueue(request);
+
+	return request->GetStatus() == EAsyncIOStatus::Cancelled ? FAsyncReadRequestPtr() : request;
+}
+
+FAsyncWriteRequestPtr FAsyncFileIO::Write(FFileHandle Handle, uint64 Offset, const uint8* Data, uint64 Size, EAsyncIOPriority Priority, FAsyncWriteRequest::FCallback&& Callback)
+{
+	FAsyncWriteRequestPtr request(new FAsyncWriteRequest(Handle, Offset, Size, Data, Priority, MoveTemp(Callback)));
+	Enqueue(request);
+
+	return request->GetStatus() == EAsyncIOStatus::Cancelled ? FAsyncWriteRequestPtr() : request;
+}
+
+int32 FAsyncFileIO::GetNumPendingRequests()
+{
+	FScopeLock lock(&QueueCriticalSection);
+
+	int32 numPending = 0;
+	for (const FRequestQueue& queue : Queues)
+	{
+		for (int32 i = queue.Head; i < queue.Requests.Num(); ++i)
+			numPending += queue.Requests[i] && queue.Requests[i]->GetStatus() == EAsyncIOStatus::Pending ? 1 : 0;
+	}
+
+	return numPending;
+}
+
+void FAsyncFileIO::Enqueue(const FAsyncIORequestPtr& Request)
+{
+	bool bRejected = false;
+
+	{
+		FScopeLock lock(&QueueCriticalSection);
+
+		if (bStopping)
+		{
+			bRejected = true;
+		}
+		else
+		{
+			if (Workers.Num() == 0)
+				StartWorkers(DefaultNumWorkers);
+
+			Queues[static_cast<int32>(Request->GetPriority())].Requests.Add(Request);
+			WorkEvent.Trigger();
+		}
+	}
+
+	if (bRejected)
+		Request->Cancel();
+}
+
+void FAsyncFileIO::StartWorkers(int32 NumWorkers)
+{
+	for (int32 i = Workers.Num(); i < NumWorkers; ++i)
+		Workers.Add(FPlatformThread::CreateThread(&WorkerMain, this));
+}
+
+void FAsyncFileIO::CompactQueue(FRequestQueue& Queue)
+{
+	if (Queue.Head * 2 < Queue.Requests.Num())
+		return;
+
+	const int32 num = Queue.Requests.Num() - Queue.Head;
+	for (int32 i = 0; i < num; ++i)
+		Queue.Requests[i] = MoveTemp(Queue.Requests[Queue.Head + i]);
+
+	Queue.Requests.SetNum(num);
+	Queue.Head = 0;
+}
+
+bool FAsyncFileIO::DequeueBatch(TArray<FAsyncIORequestPtr>& OutBatch)
+{
+	// Take the oldest request of the highest priority, skipping cancelled ones
+
+	FAsyncIORequestPtr first;
+	for (int32 priority = static_cast<int32>(EAsyncIOPriority::Count) - 1; priority >= 0 && !first; --priority)
+	{
+		FRequestQueue& queue = Queues[priority];
+		while (queue.Head < queue.Requests.Num() && !first)
+		{
+			FAsyncIORequestPtr& request = queue.Requests[queue.Head++];
+			if (request && request->TransitionStatus(EAsyncIOStatus::Pending, EAsyncIOStatus::InFlight))
+				first = request;
+
+			request = nullptr;
+		}
+
+		CompactQueue(queue);
+	}
+
+	if (!first)
+		return false;
+
+	OutBatch.Add(first);
+
+	if (!first->IsRead())
+		return true;
+
+	// Grow the range on both ends with pending reads of the same file, of any priority
+
+	uint64 rangeStart = first->Offset;
+	uint64 rangeEnd = first->Offset + first->Size;
+
+	bool bExtended = true;
+	while (bExtended)
+	{
+		bExtended = false;
+
+		for (FRequestQueue& queue : Queues)
+		{
+			for (int32 i = queue.Head; i < queue.Requests.Num(); ++i)
+			{
+				FAsyncIORequestPtr& request = queue.Requests[i];
+				if (!request || !request->IsRead() || request->Handle != first->Handle || request->Size == 0)
+					continue;
+
+				const bool bAppend = request->Offset == rangeEnd;
+				const bool bPrepend = request->Offset + request->Size == rangeStart;
+
+				if ((!bAppend && !bPrepend) || rangeEnd - rangeStart + request->Size > MaxCoalescedBytes)
+					continue;
+
+				if (!request->TransitionStatus(EAsyncIOStatus::Pending, EAsyncIOStatus::InFlight))
+					continue;
+
+				if (bAppend)
+					rangeEnd += request->Size;
+				else
+					rangeStart -= request->Size;
+
+				OutBatch.Add(request);
+				request = nullptr;
+				bExtended = true;
+			}
+		}
+	}
+
+	// Sort by offset, batches are small so an insertion sort is enough
+
+	for (int32 i = 1; i < OutBatch.Num(); ++i)
+	{
+		for (int32 j = i; j > 0 && OutBatch[j]->Offset < OutBatch[j - 1]->Offset; --j)
+			Swap(OutBatch[j], OutBatch[j - 1]);
+	}
+
+	return true;
+}
+
+void FAsyncFileIO::ExecuteBatch(TArray<FAsyncIORequestPtr>& Batch, TArray<uint8>& ScratchBuffer)
+{
+	FAsyncIORequest* first = Batch[0].Get();
+
+	if (Batch.Num() == 1)
+	{
+		bool bSuccess = false;
+
+		if (first->IsRead())
+		{
+			FReadFileOptions options;
+			options.Offset = first->Offset;
+
+			bSuccess = FFilesystem::ReadData(first->Handle, static_cast<FAsyncReadRequest*>(first)->GetData(), first->Size, options);
+		}
+		else
+		{
+			FGenericWriteFileOptions options;
+			options.Offset = first->Offset;
+
+			bSuccess = FFilesystem::WriteData(first->Handle, static_cast<FAsyncWriteRequest*>(first)->GetData(), first->Size, options);
+		}
+
+		first->Complete(bSuccess ? EAsyncIOStatus::Completed : EAsyncIOStatus::Failed, bSuccess ? first->Size : 0);
+		return;
+	}
+
+	// Coalesced reads cover one contiguous range, read it once and scatter it into the request buffers
+
+	const uint64 rangeStart = first->Offset;
+	const FAsyncIORequest* last = Batch[Batch.Num() - 1].Get();
+	const uint64 rangeSize = last->Offset + last->Size - rangeStart;
+
+	ScratchBuffer.SetNumUninitialized(static_cast<int32>(rangeSize));
+
+	FReadFileOptions options;
+	options.Offset = rangeStart;
+
+	const bool bSuccess = FFilesystem::ReadData(first->Handle, ScratchBuffer.GetData(), rangeSize, options);
+
+	for (int32 i = 0; i < Batch.Num(); ++i)
+	{
+		FAsyncReadRequest* request = static_cast<FAsyncReadRequest*>(Batch[i].Get());
+
+		if (bSuccess)
+			FMemory::Memcpy(request->GetData(), ScratchBuffer.GetData() + (request->Offset - rangeStart), request->Size);
+
+		request->Complete(bSuccess ? EAsyncIOStatus::Completed : EAsyncIOStatus::Failed, bSuccess ? request->Size : 0);
+	}
+}
+
+void FAsyncFileIO::WorkerMain(void* Parameter)
+{
+	FAsyncFileIO* asyncFileIO = static_cast<FAsyncFileIO*>(Parameter);
+
+	// Buffer for coalesced reads, reused for all batches of this worker
+	TArray<uint8> scratchBuffer;
+
+	TArray<FAsyncIORequestPtr> batch;
+
+	for (;;)
+	{
+		bool bHasBatch = false;
+
+		{
+			FScopeLock lock(&asyncFileIO->QueueCriticalSection);
+
+			if (asyncFileIO->bStopping)
+				break;
+
+			bHasBatch = asyncFileIO->DequeueBatch(batch);
+
+			// Reset under the lock, so a request queued afterwards always triggers the event again
+			if (!bHasBatch)
+				asyncFileIO->WorkEvent.Reset();
+		}
+
+		if (bHasBatch)
+		{
+			asyncFileIO->ExecuteBatch(batch, scratchBuffer);
+			batch.Empty();
+		}
+		else
+		{
+			asyncFileIO->WorkEvent.Wait();
+		}
+	}
+}
\ No newline at end of file
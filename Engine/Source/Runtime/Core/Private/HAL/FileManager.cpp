@@ -1,19 +1,119 @@
 #include "HAL/FileManager.h"
+#include "HAL/ParallelFor.h"
 
+#include "Containers/StringBuilder.h"
+
+#include "Math/Math.h"
+
+#include "Misc/Crc.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/StringSearch.h"
 
-#include "Containers/Map.h"
+#include "Platform/PlatformAtomics.h"
 
-struct FPackagedFile
+/**
+* Package mapped into memory as a whole, shared by the packaged file managers.
+*/
+class FPackagedFiles
 {
-	/** Absolute path to the file. */
-	FString Path;
+public:
+
+	FPackagedFiles(const FString& PackageFilename);
 
-	/** Offset to the start of the file. */
-	uint64 Offset;
+	/**
+	* Finds the metadata of a file.
+	* @param InPath - Normalized path of the file in the package.
+	* @return The metadata, or nullptr if the file isn't in the package.
+	*/
+	const FPackagedFileMetadata* FindFile(FStringView InPath) const;
+
+	// @return Pointer to the data of an uncompressed file
+	FORCEINLINE const uint8* GetFileData(const FPackagedFileMetadata& File) const { return Region.GetData() + File.Offset; }
+
+	/**
+	* Reads a range of a file, decompressing the blocks it covers in parallel.
+	* @param File - The file to read from.
+	* @param OutData - Buffer of at least Size bytes.
+	* @param Offset - Offset in the file, the range has to be within the file.
+	* @param Size - Number of bytes to read.
+	* @return true if the range was read, false if a block is malformed.
+	*/
+	bool ReadFile(const FPackagedFileMetadata& File, uint8* OutData, uint64 Offset, uint64 Size) const;
 
-	/** Size of the file. */
-	uint64 Size;
+	/**
+	* Verifies the checksums of the ranges of an uncompressed file that a read touches, each range is only verified once.
+	* Files before version 5 have a single checksum, so their first read verifies the whole file.
+	* @return true if the ranges are intact or have no checksum.
+	*/
+	bool VerifyRange(const FPackagedFileMetadata& File, uint64 Offset, uint64 Size) const;
+
+private:
+
+	bool Load(const FString& PackageFilename);
+
+	// @return true if the blocks of a compressed file are consistent with its size and within the data section
+	static bool ValidateBlocks(const FPackagedFileMetadata& File, uint64 DataEnd);
+
+	// @return Size of the checksum ranges of an uncompressed file, the whole file before version 5
+	static FORCEINLINE uint64 GetRangeSize(const FPackagedFileMetadata& File)
+	{
+		return File.HasRangeChecksums() ? IE_PACKAGED_FILES_CHECKSUM_RANGE_SIZE : FMath::Max<uint64>(File.Size, 1);
+	}
+
+	static FORCEINLINE uint64 GetNumRanges(const FPackagedFileMetadata& File)
+	{
+		return (File.Size + GetRangeSize(File) - 1) / GetRangeSize(File);
+	}
+
+	// @return true if a block as stored matches its checksum or has none
+	bool VerifyBlock(const FPackagedFileMetadata& File, int32 BlockIndex) const;
+
+	/**
+	* Copies a part of a block, through the block cache if the block is compressed.
+	* @return false if the block is malformed.
+	*/
+	bool ReadPartialBlock(const FPackagedFileMetadata& File, int32 BlockIndex, uint8* OutData, uint32 OffsetInBlock, uint32 Size) const;
+
+private:
+
+	/** Number of decompressed blocks kept for reads that cover blocks partially. */
+	static constexpr int32 NumCachedBlocks = 16;
+
+	enum ERangeState : FAtomic
+	{
+		RangeState_Unverified = 0,
+		RangeState_Verified,
+		RangeState_Corrupt,
+	};
+
+	struct FCachedBlock
+	{
+		const FPackagedFileMetadata* File = nullptr;
+		int32 BlockIndex = -1;
+
+		// Value of the cache clock when the block was last used, the least recently used block is replaced
+		uint64 LastUse = 0;
+
+		TArray<uint8> Data;
+	};
+
+	/** Mapping of the whole package, file data is read straight from it. */
+	FMappedFileRegion Region;
+
+	/** Metadata of all files, sorted by path hash. */
+	TArray<FPackagedFileMetadata> Files;
+
+	/** ERangeState of each checksum range of the uncompressed files, ranges are verified when they are first read. */
+	mutable TArray<FAtomic> RangeStates;
+
+	/** Index of the first range state of each file. */
+	TArray<int32> FirstRangeStates;
+
+	/** Blocks decompressed by partial reads, so reading a file in small pieces doesn't decompress every block many times. */
+	mutable FCachedBlock BlockCache[NumCachedBlocks];
+	mutable uint64 BlockCacheClock = 0;
+	mutable FCriticalSection BlockCacheCriticalSection;
 };
 
 /**
@@ -40,37 +140,48 @@ private:
 };
 
 /**
-* File manager that reads and writes files from a single file.
+* File manager that reads files from the package.
+* The package is read-only, files are served from its memory mapping.
 */
 class FPackagedFileManager final : public IFileManager
 {
+public:
+
+	/**
+	* @param InPackagedFiles - The package to read from.
+	* @param InMountPoint - Directory of the package this file manager is based in.
+	*/
+	FPackagedFileManager(const FPackagedFiles& InPackagedFiles, const FString& InMountPoint);
+
 public:
 
 	//~ IFileManager interface
 
 	bool WriteBytes(const FString& InPath, const TArray<uint8>& Data) override;
 	bool ReadBytes(const FString& InPath, TArray<uint8>& OutData, const FReadFileOptions& Options = FReadFileOptions()) override;
+	bool GetFileView(const FString& InPath, const uint8*& OutData, uint64& OutSize) override;
 
 	//~ End IFileManager interface
 
 private:
 
-	/**
-	* Caches the file data.
-	*/
-	void CacheFiles();
+	const FPackagedFileMetadata* FindFile(const FString& InPath) const;
 
-	/** 
-	* Cached files. 
-	* Key: Relative path to the file.
-	* Value: File data.
-	*/
-	TMap<FString, FPackagedFile> Files;
+private:
+
+	const FPackagedFiles& PackagedFiles;
+
+	/** Normalized mount point including a trailing slash, empty for the root of the package. */
+	FString MountPoint;
 };
 
 #if IE_PACKAGED_BUILD
 
-static FPackagedFileManager GPackagedFileManager;
+static const FPackagedFiles& GetPackagedFiles()
+{
+	static FPackagedFiles packagedFiles(FPaths::Combine(FPaths::GameRootDir(), TEXT(IE_PACKAGED_FILES_FILENAME)));
+	return packagedFiles;
+}
 
 #endif
 
@@ -78,7 +189,8 @@ IFileManager& IFileManager::GetEngineFileManager()
 {
 #if IE_PACKAGED_BUILD
 
-	return GPackagedFileManager;
+	static FPackagedFileManager manager(GetPackagedFiles(), TEXT("Engine"));
+	return manager;
 
 #else
 
@@ -92,7 +204,8 @@ IFileManager& IFileManager::GetGameFileManager()
 {
 #if IE_PACKAGED_BUILD
 
-	return GPackagedFileManager;
+	static FPackagedFileManager manager(GetPackagedFiles(), FString());
+	return manager;
 
 #else
 
@@ -124,21 +237,364 @@ bool FFileManager::ReadBytes(const FString& InPath, TArray<uint8>& OutData, cons
 }
 
 
+FPackagedFiles::FPackagedFiles(const FString& PackageFilename)
+{
+	if (!Load(PackageFilename))
+	{
+		Region.Unmap();
+		Files.Empty();
+	}
+}
 
-bool FPackagedFileManager::WriteBytes(const FString& InPath, const TArray<uint8>& Data)
+bool FPackagedFiles::Load(const FString& PackageFilename)
 {
-	return false;
+	// The package stays mapped for the lifetime of the process, the file handle isn't needed after mapping
+
+	FMappedFileHandle package;
+	if (!package.Open(PackageFilename) || package.GetFileSize() < FPackagedFilesFooter::SerializedSize || !package.MapRegion(Region))
+		return false;
+
+	const uint64 packageSize = Region.GetSize();
+
+	FPackagedFilesFooter footer;
+	FMemoryReader footerReader(Region.GetData() + packageSize - FPackagedFilesFooter::SerializedSize, FPackagedFilesFooter::SerializedSize);
+	footerReader << footer;
+
+	const uint64 metadataEnd = packageSize - FPackagedFilesFooter::SerializedSize;
+
+	if (footerReader.IsError() || footer.Magic != IE_PACKAGED_FILES_MAGIC || footer.Version > IE_PACKAGED_FILES_METADATA_VERSION)
+		return false;
+
+	if (footer.MetadataOffset > metadataEnd || footer.MetadataSize > metadataEnd - footer.MetadataOffset)
+		return false;
+
+	// The metadata is followed by its checksum since version 4
+
+	uint64 metadataSize = footer.MetadataSize;
+
+	if (footer.Version >= 4)
+	{
+		uint32 metadataChecksum = 0;
+		if (metadataSize < sizeof(metadataChecksum))
+			return false;
+
+		metadataSize -= sizeof(metadataChecksum);
+		FMemory::Memcpy(&metadataChecksum, Region.GetData() + footer.MetadataOffset + metadataSize, sizeof(metadataChecksum));
+
+		if (FCrc::Crc32C(Region.GetData() + footer.MetadataOffset, metadataSize) != metadataChecksum)
+			return false;
+	}
+
+	FPacakgedFilesMetadata metadata;
+	FMemoryReader metadataReader(Region.GetData() + footer.MetadataOffset, metadataSize);
+	metadataReader << metadata;
+
+	if (metadataReader.IsError())
+		return false;
+
+	// Reject files outside of the data section and metadata that isn't sorted, lookups rely on both
+
+	for (int32 i = 0; i < metadata.Files.Num(); ++i)
+	{
+		const FPackagedFileMetadata& file = metadata.Files[i];
+
+		if (file.IsCompressed() ? !ValidateBlocks(file, footer.MetadataOffset) : (file.Offset > footer.MetadataOffset || file.Size > footer.MetadataOffset - file.Offset))
+			return false;
+
+		if (file.HasRangeChecksums() && static_cast<uint64>(file.RangeChecksums.Num()) != (file.IsCompressed() ? 0 : GetNumRanges(file)))
+			return false;
+
+		if (i > 0 && file.PathHash < metadata.Files[i - 1].PathHash)
+			return false;
+	}
+
+	Files = MoveTemp(metadata.Files);
+
+	int32 numRangeStates = 0;
+	FirstRangeStates.SetNumUninitialized(Files.Num());
+
+	for (int32 i = 0; i < Files.Num(); ++i)
+	{
+		FirstRangeStates[i] = numRangeStates;
+		if (!Files[i].IsCompressed() && Files[i].HasChecksums())
+			numRangeStates += static_cast<int32>(GetNumRanges(Files[i]));
+	}
+
+	RangeStates.SetNum(numRangeStates);
+
+	return true;
 }
 
-bool FPackagedFileManager::ReadBytes(const FString& InPath, TArray<uint8>& OutData, const FReadFileOptions& Options)
+bool FPackagedFiles::ValidateBlocks(const FPackagedFileMetadata& File, uint64 DataEnd)
 {
+	if (File.CompressionMethod >= ECompressionMethod::Count || File.CompressionBlockSize == 0 || File.CompressionBlockSize > static_cast<uint32>(MAX_int32))
+		return false;
+
+	const uint64 numBlocks = File.Size / File.CompressionBlockSize + (File.Size % File.CompressionBlockSize != 0 ? 1 : 0);
+	if (numBlocks != static_cast<uint64>(File.Blocks.Num()))
+		return false;
+
+	for (int32 i = 0; i < File.Blocks.Num(); ++i)
+	{
+		const FPackagedFileBlock& block = File.Blocks[i];
+
+		if (block.Offset > DataEnd || block.CompressedSize > DataEnd - block.Offset || block.CompressedSize > File.GetBlockSize(i))
+			return false;
+	}
+
+	return true;
+}
+
+bool FPackagedFiles::ReadFile(const FPackagedFileMetadata& File, uint8* OutData, uint64 Offset, uint64 Size) const
+{
+	if (Size == 0)
+		return true;
+
+	if (!File.IsCompressed())
+	{
+		if (!VerifyRange(File, Offset, Size))
+			return false;
+
+		FMemory::Memcpy(OutData, GetFileData(File) + Offset, Size);
+		return true;
+	}
+
+	const uint64 blockSize = File.CompressionBlockSize;
+	const int32 firstBlock = static_cast<int32>(Offset / blockSize);
+	const int32 lastBlock = static_cast<int32>((Offset + Size - 1) / blockSize);
+
+	volatile FAtomic bFailed = 0;
+
+	ParallelFor(lastBlock - firstBlock + 1, [this, &File, OutData, Offset, Size, blockSize, firstBlock, &bFailed](int32 Index)
+	{
+		const int32 blockIndex = firstBlock + Index;
+		const FPackagedFileBlock& block = File.Blocks[blockIndex];
+
+		const uint64 blockStart = static_cast<uint64>(blockIndex) * blockSize;
+		const uint32 uncompressedSize = File.GetBlockSize(blockIndex);
+
+		// Part of the block within the requested range
+
+		const uint64 copyStart = FMath::Max(Offset, blockStart);
+		const uint64 copyEnd = FMath::Min(Offset + Size, blockStart + uncompressedSize);
+
+		uint8* dst = OutData + (copyStart - Offset);
+		bool bSuccess = true;
+
+		if (block.CompressedSize == uncompressedSize)
+		{
+			// Stored as is
+			bSuccess = VerifyBlock(File, blockIndex);
+			if (bSuccess)
+				FMemory::Memcpy(dst, Region.GetData() + block.Offset + (copyStart - blockStart), copyEnd - copyStart);
+		}
+		else if (copyStart == blockStart && copyEnd == blockStart + uncompressedSize)
+		{
+			bSuccess = VerifyBlock(File, blockIndex) && FCompression::UncompressMemory(File.CompressionMethod, dst, static_cast<int32>(uncompressedSize), Region.GetData() + block.Offset, static_cast<int32>(block.CompressedSize));
+		}
+		else
+		{
+			bSuccess = ReadPartialBlock(File, blockIndex, dst, static_cast<uint32>(copyStart - blockStart), static_cast<uint32>(copyEnd - copyStart));
+		}
+
+		if (!bSuccess)
+			FPlatformAtomics::InterlockedExchange(&bFailed, 1);
+	});
+
+	return FPlatformAtomics::AtomicRead(&bFailed) == 0;
+}
+
+bool FPackagedFiles::ReadPartialBlock(const FPackagedFileMetadata& File, int32 BlockIndex, uint8* OutData, uint32 OffsetInBlock, uint32 Size) const
+{
+	{
+		FScopeLock lock(&BlockCacheCriticalSection);
+
+		for (FCachedBlock& cachedBlock : BlockCache)
+		{
+			if (cachedBlock.File == &File && cachedBlock.BlockIndex == BlockIndex)
+			{
+				cachedBlock.LastUse = ++BlockCacheClock;
+				FMemory::Memcpy(OutData, cachedBlock.Data.GetData() + OffsetInBlock, Size);
+
+				return true;
+			}
+		}
+	}
+
+	// Verify and decompress outside of the lock, other blocks can be read in the meantime
+
+	if (!VerifyBlock(File, BlockIndex))
+		return false;
+
+	const FPackagedFileBlock& block = File.Blocks[BlockIndex];
+	const int32 uncompressedSize = static_cast<int32>(File.GetBlockSize(BlockIndex));
+
+	TArray<uint8> data;
+	data.SetNumUninitialized(uncompressedSize);
+
+	if (!FCompression::UncompressMemory(File.CompressionMethod, data.GetData(), uncompressedSize, Region.GetData() + block.Offset, static_cast<int32>(block.CompressedSize)))
+		return false;
+
+	FMemory::Memcpy(OutData, data.GetData() + OffsetInBlock, Size);
+
+	FScopeLock lock(&BlockCacheCriticalSection);
+
+	// Replace the least recently used block, unless another thread cached this block in the meantime
+
+	FCachedBlock* slot = &BlockCache[0];
+	for (FCachedBlock& cachedBlock : BlockCache)
+	{
+		if (cachedBlock.File == &File && cachedBlock.BlockIndex == BlockIndex)
+			return true;
+
+		if (cachedBlock.LastUse < slot->LastUse)
+			slot = &cachedBlock;
+	}
+
+	slot->File = &File;
+	slot->BlockIndex = BlockIndex;
+	slot->LastUse = ++BlockCacheClock;
+	slot->Data = MoveTemp(data);
+
+	return true;
+}
+
+bool FPackagedFiles::VerifyRange(const FPackagedFileMetadata& File, uint64 Offset, uint64 Size) const
+{
+	if (!File.HasChecksums() || Size == 0)
+		return true;
+
+	FAtomic volatile* states = RangeStates.GetData() + FirstRangeStates[static_cast<int32>(&File - Files.GetData())];
+
+	const uint64 rangeSize = GetRangeSize(File);
+	const int32 firstRange = static_cast<int32>(Offset / rangeSize);
+	const int32 lastRange = static_cast<int32>((Offset + Size - 1) / rangeSize);
+
+	for (int32 range = firstRange; range <= lastRange; ++range)
+	{
+		FAtomic currentState = FPlatformAtomics::AtomicRead(&states[range]);
+		if (currentState == RangeState_Unverified)
+		{
+			const uint64 rangeStart = static_cast<uint64>(range) * rangeSize;
+			const uint32 checksum = File.HasRangeChecksums() ? File.RangeChecksums[range] : File.Checksum;
+
+			// Threads reading the same range for the first time may both compute the checksum, they store the same result
+			currentState = FCrc::Crc32C(GetFileData(File) + rangeStart, FMath::Min(rangeSize, File.Size - rangeStart)) == checksum ? RangeState_Verified : RangeState_Corrupt;
+			FPlatformAtomics::InterlockedExchange(&states[range], currentState);
+		}
+
+		if (currentState != RangeState_Verified)
+			return false;
+	}
+
+	return true;
+}
+
+bool FPackagedFiles::VerifyBlock(const FPackagedFileMetadata& File, int32 BlockIndex) const
+{
+	const FPackagedFileBlock& block = File.Blocks[BlockIndex];
+	return !File.HasChecksums() || FCrc::Crc32C(Region.GetData() + block.Offset, block.CompressedSize) == block.Checksum;
+}
+
+const FPackagedFileMetadata* FPackagedFiles::FindFile(FStringView InPath) const
+{
+	const uint32 pathHash = GetTypeHash(InPath);
+
+	// Binary search for the first file with the hash
+
+	int32 first = 0;
+	int32 last = Files.Num();
+
+	while (first < last)
+	{
+		const int32 middle = first + (last - first) / 2;
+		if (Files[middle].PathHash < pathHash)
+			first = middle + 1;
+		else
+			last = middle;
+	}
+
+	for (int32 i = first; i < Files.Num() && Files[i].PathHash == pathHash; ++i)
+	{
+		// Compared with the folding of the hash, so a path is found with every casing that hashes the same
+		const FString& path = Files[i].Path;
+		if (path.Length() == InPath.Length() && FStringSearch::EqualsIgnoreCaseAscii(*path, InPath.GetData(), InPath.Length()))
+			return &Files[i];
+	}
+
+	return nullptr;
+}
+
+FPackagedFileManager::FPackagedFileManager(const FPackagedFiles& InPackagedFiles, const FString& InMountPoint)
+	: PackagedFiles(InPackagedFiles)
+	, MountPoint(FPackagedFileMetadata::NormalizePath(InMountPoint))
+{
+	if (!MountPoint.IsEmpty())
+		MountPoint.InlineAppendChar(TEXT('/'));
+}
+
+bool FPackagedFileManager::WriteBytes(const FString& InPath, const TArray<uint8>& Data)
+{
+	// The package is read-only
 	return false;
 }
 
-void FPackagedFileManager::CacheFiles()
+bool FPackagedFileManager::ReadBytes(const FString& InPath, TArray<uint8>& OutData, const FReadFileOptions& Options)
 {
-	if (Files.Num() == 0)
+	OutData.Empty();
+
+	const FPackagedFileMetadata* file = FindFile(InPath);
+	if (!file)
+		return false;
+
+	const uint64 bytesToRead = FFilesystem::CalculateBytesToRead(file->Size, Options);
+	if (bytesToRead > static_cast<uint64>(MAX_int32))
+		return false;
+
+	if (bytesToRead > 0)
 	{
+		OutData.SetNumUninitialized(static_cast<int32>(bytesToRead));
 
+		if (!PackagedFiles.ReadFile(*file, OutData.GetData(), Options.Offset, bytesToRead))
+		{
+			OutData.Empty();
+			return false;
+		}
 	}
+
+	return true;
+}
+
+bool FPackagedFileManager::GetFileView(const FString& InPath, const uint8*& OutData, uint64& OutSize)
+{
+	// Compressed files have no contiguous data to view.
+	// The view isn't verified, that would read the whole file up front, reads verify the ranges they touch.
+	const FPackagedFileMetadata* file = FindFile(InPath);
+	if (!file || file->IsCompressed())
+		return false;
+
+	OutData = PackagedFiles.GetFileData(*file);
+	OutSize = file->Size;
+
+	return true;
 }
+
+const FPackagedFileMetadata* FPackagedFileManager::FindFile(const FString& InPath) const
+{
+	// Normalizes like FPackagedFileMetadata::NormalizePath, into a stack buffer so lookups don't allocate
+
+	TStringBuilder<IE_PATHS_BUILDER_SIZE> path;
+	path.Append(MountPoint);
+
+	FStringView relativePath = FStringView(InPath).TrimStart(TEXT("/\\"));
+	for (int32 separator = relativePath.FindChar(TEXT('\\')); separator != INDEX_NONE; separator = relativePath.FindChar(TEXT('\\')))
+	{
+		path.Append(relativePath.Left(separator));
+		path.AppendChar(TEXT('/'));
+		relativePath = relativePath.Right(separator);
+	}
+
+	path.Append(relativePath);
+
+	return PackagedFiles.FindFile(path.ToView());
+}
\ No newline at end of file
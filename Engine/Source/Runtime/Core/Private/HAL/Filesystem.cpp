@@ -1,12 +1,16 @@
 #include "HAL/Filesystem.h"
 
 #include "Misc/Paths.h"
+#include "Text/Encoding.h"
 
 uint64 FFilesystem::CalculateBytesToRead(uint64 FileSize, const FReadFileOptions& Options)
 {
 	/*const uint64 bytesToRead = Options.MaxBytesToRead == 0 ? FileSize : FMath::Min(Options.MaxBytesToRead, FileSize);
 	return bytesToRead > Options.Offset ? bytesToRead - Options.Offset : 0;*/
 
+	if (Options.Offset >= FileSize)
+		return 0;
+
 	uint64 maxBytes = FileSize - Options.Offset;
 	if (Options.MaxBytesToRead > 0)
 		maxBytes = FMath::Min(maxBytes, Options.MaxBytesToRead);
@@ -36,6 +40,11 @@ bool FFilesystem::ReadBytes(FFileHandle Handle, TArray<uint8>& OutData, const FR
 
 	const uint64 bytesToRead = CalculateBytesToRead(fileSize, Options);
 
+	// Arrays are indexed with int32, larger files have to be mapped with FMappedFileHandle instead
+
+	if (bytesToRead > static_cast<uint64>(MAX_int32))
+		return false;
+
 	// Read data
 
 	OutData.SetNumUninitialized((int32)bytesToRead);
@@ -62,6 +71,16 @@ bool FFileHelper::ReadBytesFromFile(const FString& Filename, TArray<uint8>& OutB
 	return bResult;
 }
 
+bool FFileHelper::ReadStringFromFile(const FString& Filename, FString& OutString)
+{
+	TArray<uint8> bytes;
+	if (!ReadBytesFromFile(Filename, bytes))
+		return false;
+
+	OutString = FEncoding::FromBytes(bytes);
+	return true;
+}
+
 bool FFileHelper::WriteBytesToFile(const FString& Filename, const TArray<uint8>& Data, bool bCreateFile)
 {
 	if(bCreateFile && !FFilesystem::IsFile(Filename))
@@ -0,0 +1,268 @@
+#include "HAL/PackagedFileWriter.h"
+
+#include "HAL/ParallelFor.h"
+
+#include "Math/Math.h"
+
+#include "Misc/Crc.h"
+#include "Misc/StringSearch.h"
+
+namespace
+{
+	/**
+	* Writes zeros up to the next multiple of the package alignment.
+	*/
+	bool WritePadding(FFileHandle Handle, uint64& InOutOffset)
+	{
+		static const uint8 zeros[IE_PACKAGED_FILES_ALIGNMENT] = {};
+
+		const uint64 padding = (IE_PACKAGED_FILES_ALIGNMENT - InOutOffset % IE_PACKAGED_FILES_ALIGNMENT) % IE_PACKAGED_FILES_ALIGNMENT;
+		InOutOffset += padding;
+
+		return padding == 0 || FFilesystem::WriteData(Handle, zeros, padding);
+	}
+}
+
+bool FPackagedFileWriter::AddFile(const FString& InPath, const FString& SourceFilename)
+{
+	FEntry* entry = AddEntry(InPath);
+	if (!entry)
+		return false;
+
+	entry->SourceFilename = SourceFilename;
+	return true;
+}
+
+bool FPackagedFileWriter::AddFile(const FString& InPath, TArray<uint8>&& Data)
+{
+	FEntry* entry = AddEntry(InPath);
+	if (!entry)
+		return false;
+
+	entry->Data = MoveTemp(Data);
+	return true;
+}
+
+void FPackagedFileWriter::SetCompression(ECompressionMethod Method, uint32 BlockSize)
+{
+	checkf(BlockSize > 0 && BlockSize <= static_cast<uint32>(MAX_int32), TEXT("Invalid compression block size."));
+
+	CompressionMethod = Method;
+	CompressionBlockSize = BlockSize;
+}
+
+bool FPackagedFileWriter::Write(const FString& PackageFilename)
+{
+	// Sort by path hash, the reader looks files up with a binary search.
+	// Heap sort, so packages with many files don't degrade to quadratic time.
+
+	auto siftDown = [this](int32 Root, int32 Num)
+	{
+		for (int32 child = Root * 2 + 1; child < Num; Root = child, child = Root * 2 + 1)
+		{
+			if (child + 1 < Num && Entries[child + 1].Metadata.PathHash > Entries[child].Metadata.PathHash)
+				++child;
+
+			if (Entries[Root].Metadata.PathHash >= Entries[child].Metadata.PathHash)
+				break;
+
+			Swap(Entries[Root], Entries[child]);
+		}
+	};
+
+	for (int32 i = Entries.Num() / 2 - 1; i >= 0; --i)
+		siftDown(i, Entries.Num());
+
+	for (int32 i = Entries.Num() - 1; i > 0; --i)
+	{
+		Swap(Entries[0], Entries[i]);
+		siftDown(0, i);
+	}
+
+	// Paths that are equal with the folding of the hash have equal hashes, so duplicates are within runs of equal hashes.
+	// Non-ASCII case variants are different files, the reader tells them apart the same way.
+
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		const FString& path = Entries[i].Metadata.Path;
+
+		for (int32 j = i + 1; j < Entries.Num() && Entries[j].Metadata.PathHash == Entries[i].Metadata.PathHash; ++j)
+		{
+			const FString& otherPath = Entries[j].Metadata.Path;
+			if (otherPath.Length() == path.Length() && FStringSearch::EqualsIgnoreCaseAscii(*otherPath, *path, path.Length()))
+				return false;
+		}
+	}
+
+	if (!FFilesystem::IsFile(PackageFilename) && !FFileHelper::CreateFilePath(PackageFilename))
+		return false;
+
+	FFileHandle handle = FFilesystem::OpenFile(PackageFilename, static_cast<EFileAccess>(FILE_Write | FILE_Truncate));
+	if (!FFilesystem::IsFileValid(handle))
+		return false;
+
+	bool bSuccess = true;
+	uint64 offset = 0;
+
+	// File data, files from disk are only loaded while they are written
+
+	FPacakgedFilesMetadata metadata;
+	metadata.Version = IE_PACKAGED_FILES_METADATA_VERSION;
+	metadata.NumFiles = static_cast<uint32>(Entries.Num());
+
+	for (int32 i = 0; i < Entries.Num() && bSuccess; ++i)
+	{
+		FEntry& entry = Entries[i];
+
+		TArray<uint8> fileData;
+		const TArray<uint8>* data = &entry.Data;
+
+		if (!entry.SourceFilename.IsEmpty())
+		{
+			bSuccess = FFileHelper::ReadBytesFromFile(entry.SourceFilename, fileData);
+			data = &fileData;
+		}
+
+		bSuccess = bSuccess && WritePadding(handle, offset);
+
+		entry.Metadata.Offset = offset;
+		entry.Metadata.Size = static_cast<uint64>(data->Num());
+		entry.Metadata.CompressionMethod = ECompressionMethod::None;
+		entry.Metadata.CompressionBlockSize = 0;
+		entry.Metadata.Blocks.Empty();
+		entry.Metadata.Checksum = 0;
+		entry.Metadata.RangeChecksums.Empty();
+
+		TArray<TArray<uint8>> blocks;
+		TArray<uint32> blockChecksums;
+
+		if (bSuccess && CompressBlocks(*data, blocks, blockChecksums))
+		{
+			// Blocks are written back to back after the aligned start of the file
+
+			entry.Metadata.CompressionMethod = CompressionMethod;
+			entry.Metadata.CompressionBlockSize = CompressionBlockSize;
+
+			for (int32 j = 0; j < blocks.Num() && bSuccess; ++j)
+			{
+				FPackagedFileBlock block;
+				block.Offset = offset;
+				block.CompressedSize = static_cast<uint32>(blocks[j].Num());
+				block.Checksum = blockChecksums[j];
+
+				entry.Metadata.Blocks.Add(block);
+
+				bSuccess = FFilesystem::WriteBytes(handle, blocks[j]);
+				offset += block.CompressedSize;
+			}
+		}
+		else
+		{
+			entry.Metadata.Checksum = FCrc::Crc32C(data->GetData(), data->Num());
+			ComputeRangeChecksums(*data, entry.Metadata.RangeChecksums);
+
+			bSuccess = bSuccess && FFilesystem::WriteBytes(handle, *data);
+			offset += entry.Metadata.Size;
+		}
+
+		metadata.Files.Add(entry.Metadata);
+	}
+
+	// Metadata and footer
+
+	if (bSuccess)
+	{
+		TArray<uint8> metadataBytes;
+		FMemoryWriter metadataWriter(metadataBytes);
+		metadataWriter << metadata;
+
+		uint32 metadataChecksum = FCrc::Crc32C(metadataBytes.GetData(), metadataBytes.Num());
+		metadataWriter << metadataChecksum;
+
+		FPackagedFilesFooter footer;
+		footer.MetadataOffset = offset;
+		footer.MetadataSize = static_cast<uint64>(metadataBytes.Num());
+
+		TArray<uint8> footerBytes;
+		FMemoryWriter footerWriter(footerBytes);
+		footerWriter << footer;
+
+		checkf(footerBytes.Num() == FPackagedFilesFooter::SerializedSize, TEXT("Invalid packaged files footer size."));
+
+		bSuccess = FFilesystem::WriteBytes(handle, metadataBytes) && FFilesystem::WriteBytes(handle, footerBytes);
+	}
+
+	FFilesystem::CloseFile(handle);
+	return bSuccess;
+}
+
+bool FPackagedFileWriter::CompressBlocks(const TArray<uint8>& Data, TArray<TArray<uint8>>& OutBlocks, TArray<uint32>& OutChecksums) const
+{
+	if (CompressionMethod == ECompressionMethod::None || Data.Num() == 0)
+		return false;
+
+	const int32 blockSize = static_cast<int32>(CompressionBlockSize);
+	const int32 numBlocks = static_cast<int32>((static_cast<int64>(Data.Num()) + blockSize - 1) / blockSize);
+
+	OutBlocks.SetNum(numBlocks);
+	OutChecksums.SetNumUninitialized(numBlocks);
+
+	ParallelFor(numBlocks, [this, &Data, &OutBlocks, &OutChecksums, blockSize](int32 BlockIndex)
+	{
+		const int32 blockStart = BlockIndex * blockSize;
+		const int32 uncompressedSize = FMath::Min(blockSize, Data.Num() - blockStart);
+
+		TArray<uint8>& block = OutBlocks[BlockIndex];
+		block.SetNumUninitialized(FCompression::CompressMemoryBound(CompressionMethod, uncompressedSize));
+
+		int32 compressedSize = block.Num();
+
+		// Blocks that don't get smaller are stored as is, the reader tells them apart by their size
+		if (FCompression::CompressMemory(CompressionMethod, block.GetData(), compressedSize, Data.GetData() + blockStart, uncompressedSize) && compressedSize < uncompressedSize)
+		{
+			block.SetNumUninitialized(compressedSize);
+		}
+		else
+		{
+			block.SetNumUninitialized(uncompressedSize);
+			FMemory::Memcpy(block.GetData(), Data.GetData() + blockStart, uncompressedSize);
+		}
+
+		// Checksum of the stored bytes, so the reader can verify a block before decompressing it
+		OutChecksums[BlockIndex] = FCrc::Crc32C(block.GetData(), block.Num());
+	});
+
+	int64 totalCompressedSize = 0;
+	for (int32 i = 0; i < numBlocks; ++i)
+		totalCompressedSize += OutBlocks[i].Num();
+
+	return totalCompressedSize < Data.Num();
+}
+
+void FPackagedFileWriter::ComputeRangeChecksums(const TArray<uint8>& Data, TArray<uint32>& OutChecksums)
+{
+	const int32 rangeSize = IE_PACKAGED_FILES_CHECKSUM_RANGE_SIZE;
+	const int32 numRanges = static_cast<int32>((static_cast<int64>(Data.Num()) + rangeSize - 1) / rangeSize);
+
+	OutChecksums.SetNumUninitialized(numRanges);
+
+	ParallelFor(numRanges, [&Data, &OutChecksums, rangeSize](int32 RangeIndex)
+	{
+		const int32 rangeStart = RangeIndex * rangeSize;
+		OutChecksums[RangeIndex] = FCrc::Crc32C(Data.GetData() + rangeStart, FMath::Min(rangeSize, Data.Num() - rangeStart));
+	});
+}
+
+FPackagedFileWriter::FEntry* FPackagedFileWriter::AddEntry(const FString& InPath)
+{
+	const FString path = FPackagedFileMetadata::NormalizePath(InPath);
+	if (path.IsEmpty())
+		return nullptr;
+
+	FEntry& entry = Entries[Entries.Emplace()];
+	entry.Metadata.Version = IE_PACKAGED_FILE_METADATA_VERSION;
+	entry.Metadata.Path = path;
+	entry.Metadata.PathHash = GetTypeHash(path);
+
+	return &entry;
+}
\ No newline at end of file
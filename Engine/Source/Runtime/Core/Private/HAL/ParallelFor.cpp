@@ -0,0 +1,142 @@
+#include "HAL/ParallelFor.h"
+
+#include "Math/Math.h"
+
+#include "Platform/PlatformAtomics.h"
+#include "Platform/PlatformEvent.h"
+#include "Platform/PlatformMisc.h"
+#include "Platform/PlatformThread.h"
+
+namespace
+{
+	/** Maximum number of worker threads, the calling thread works as well. */
+	constexpr int32 MaxParallelForWorkers = 15;
+
+	/**
+	* Pool of worker threads that runs one ParallelFor at a time.
+	*/
+	class FParallelForPool
+	{
+		struct FWorker
+		{
+			FParallelForPool* Pool = nullptr;
+
+			// Triggered when the worker should join the current job
+			FEvent WakeEvent;
+		};
+
+	public:
+
+		/**
+		* Gets the pool, the worker threads are started on first use.
+		* The pool is never destroyed, its workers live as long as the process.
+		*/
+		static FParallelForPool& Get()
+		{
+			static FParallelForPool* pool = new FParallelForPool();
+			return *pool;
+		}
+
+		FParallelForPool()
+		{
+			NumWorkers = FMath::Clamp(FPlatformMisc::NumberOfCores() - 1, 0, MaxParallelForWorkers);
+
+			for (int32 i = 0; i < NumWorkers; ++i)
+			{
+				Workers[i].Pool = this;
+				FPlatformThread::CreateThread(&WorkerMain, &Workers[i]);
+			}
+		}
+
+		/**
+		* Runs a job on the pool and the calling thread.
+		* @return false if the pool is busy or has no workers, the job didn't run then.
+		*/
+		bool Run(int32 Num, TFunctionRef<void(int32)>& Body)
+		{
+			if (NumWorkers == 0 || FPlatformAtomics::InterlockedCompareExchange(&bBusy, 1, 0) != 0)
+				return false;
+
+			const int32 numWorkersToWake = FMath::Min(NumWorkers, Num - 1);
+
+			JobBody = &Body;
+			JobNum = Num;
+			NextIndex = 0;
+			NumActiveWorkers = numWorkersToWake;
+
+			for (int32 i = 0; i < numWorkersToWake; ++i)
+				Workers[i].WakeEvent.Trigger();
+
+			ProcessIndices();
+
+			// The job lives on the stack of the caller, wait until no worker uses it anymore
+			if (numWorkersToWake > 0)
+				DoneEvent.Wait();
+
+			FPlatformAtomics::InterlockedExchange(&bBusy, 0);
+			return true;
+		}
+
+	private:
+
+		void ProcessIndices()
+		{
+			for (;;)
+			{
+				const int32 index = FPlatformAtomics::InterlockedIncrement(&NextIndex) - 1;
+				if (index >= JobNum)
+					break;
+
+				(*JobBody)(index);
+			}
+		}
+
+		static void WorkerMain(void* Parameter)
+		{
+			FWorker* worker = static_cast<FWorker*>(Parameter);
+			FParallelForPool* pool = worker->Pool;
+
+			for (;;)
+			{
+				worker->WakeEvent.Wait();
+
+				pool->ProcessIndices();
+
+				if (FPlatformAtomics::InterlockedDecrement(&pool->NumActiveWorkers) == 0)
+					pool->DoneEvent.Trigger();
+			}
+		}
+
+	private:
+
+		FWorker Workers[MaxParallelForWorkers];
+		int32 NumWorkers = 0;
+
+		/** Set while a job runs, further calls run on their calling thread. */
+		volatile FAtomic bBusy = 0;
+
+		TFunctionRef<void(int32)>* JobBody = nullptr;
+		int32 JobNum = 0;
+
+		/** Next index to hand out. */
+		volatile FAtomic NextIndex = 0;
+
+		/** Number of woken workers that haven't finished the job yet. */
+		volatile FAtomic NumActiveWorkers = 0;
+
+		/** Triggered by the last worker that finishes a job. */
+		FEvent DoneEvent;
+	};
+}
+
+void ParallelFor(int32 Num, TFunctionRef<void(int32)> Body)
+{
+	if (Num <= 0)
+		return;
+
+	if (Num > 1 && FParallelForPool::Get().Run(Num, Body))
+		return;
+
+	for (int32 i = 0; i < Num; ++i)
+		Body(i);
+}
\ No newline at end of file
@@ -3,13 +3,125 @@
 
 #include "Platform/PlatformMisc.h"
 
-#include "Misc/Parse.h"
+#include "Misc/Tokenizer.h"
+
+#include "Containers/Map.h"
+#include "Containers/InternedString.h"
 
 FString FCommandLine::s_CommandLine;
 
+namespace
+{
+	struct FCommandLineSwitch
+	{
+		/** The name as it was written, without '-'. */
+		FInternedString Key;
+
+		FString Value;
+		bool bHasValue = false;
+	};
+
+	struct FCommandLineIndex
+	{
+		TArray<FString> Arguments;
+		TArray<FCommandLineSwitch> Switches;
+
+		/** Index of the first switch with a name, case insensitive. */
+		TMap<FInternedString, int32> SwitchIndices;
+	};
+
+	// Constructed on first use, the command line may be queried during static initialization
+	FCommandLineIndex& GetIndex()
+	{
+		static FCommandLineIndex index;
+		return index;
+	}
+
+	// Removes the '-' before and the '=' after the name of a switch
+	FStringView GetSwitchName(FStringView InKey)
+	{
+		if (!InKey.IsEmpty() && InKey[0] == TEXT('-'))
+			InKey = InKey.Mid(1, InKey.Length() - 1);
+
+		if (!InKey.IsEmpty() && InKey[InKey.Length() - 1] == TEXT('='))
+			InKey = InKey.Left(InKey.Length() - 1);
+
+		return InKey;
+	}
+
+	/**
+	* Finds the first switch with a name.
+	* @param bNeedsValue - Skips switches without a value, so -map -map=Name has a value.
+	*/
+	const FCommandLineSwitch* FindSwitch(FStringView InKey, ESearchCase InSearchCase, bool bNeedsValue)
+	{
+		const FStringView name = GetSwitchName(InKey);
+
+		// A name that was never interned can't be on the command line
+		const FInternedString key = FInternedString::FindAnyCasing(name);
+		if (key.IsEmpty())
+			return nullptr;
+
+		const FCommandLineIndex& index = GetIndex();
+
+		const int32* switchIndex = index.SwitchIndices.Find(key);
+		if (!switchIndex)
+			return nullptr;
+
+		const FCommandLineSwitch& commandLineSwitch = index.Switches[*switchIndex];
+		if ((commandLineSwitch.bHasValue || !bNeedsValue) && commandLineSwitch.Key.ToView().Equals(name, InSearchCase))
+			return &commandLineSwitch;
+
+		// The first switch with the name has another casing or no value, rare enough to look through the ones after it
+		for (int32 i = *switchIndex + 1; i < index.Switches.Num(); ++i)
+		{
+			const FCommandLineSwitch& other = index.Switches[i];
+			if ((other.bHasValue || !bNeedsValue) && other.Key.ToView().Equals(name, InSearchCase))
+				return &other;
+		}
+
+		return nullptr;
+	}
+}
+
 void FCommandLine::Init(const FString& CommandLine)
 {
 	s_CommandLine = CommandLine;
+
+	FCommandLineIndex& index = GetIndex();
+	index.Arguments.Empty();
+	index.Switches.Empty();
+	index.SwitchIndices.Clear();
+
+	// No escape character, quoted paths may end with a backslash like -dir="C:\Foo\"
+	for (FStringView argument : FTokenizer(s_CommandLine, false, false, TEXT(' '), TEXT('\"')))
+	{
+		index.Arguments.Add(FString(argument));
+
+		// Switches start with '-' or have a value, other arguments like the executable aren't indexed
+
+		const int32 equalsIndex = argument.FindChar(TEXT('='));
+		if (argument[0] != TEXT('-') && equalsIndex == INDEX_NONE)
+			continue;
+
+		const FStringView name = GetSwitchName(equalsIndex != INDEX_NONE ? argument.Left(equalsIndex) : argument);
+		if (name.IsEmpty())
+			continue;
+
+		FCommandLineSwitch commandLineSwitch;
+		commandLineSwitch.Key = FInternedString(name);
+
+		if (equalsIndex != INDEX_NONE)
+		{
+			commandLineSwitch.Value = FString(argument.Mid(equalsIndex + 1, argument.Length() - equalsIndex - 1));
+			commandLineSwitch.bHasValue = true;
+		}
+
+		if (!index.SwitchIndices.Contains(commandLineSwitch.Key))
+			index.SwitchIndices.Add(commandLineSwitch.Key, index.Switches.Num());
+
+		index.Switches.Add(commandLineSwitch);
+	}
 }
 
 void FCommandLine::Init(int32 ArgC, char** ArgV)
@@ -45,10 +157,22 @@ const FString& FCommandLine::Get()
 	return s_CommandLine;
 }
 
-TArray<FString> FCommandLine::GetAsArray()
+const TArray<FString>& FCommandLine::GetAsArray()
+{
+	return GetIndex().Arguments;
+}
+
+bool FCommandLine::Param(FStringView Key, ESearchCase SearchCase)
+{
+	return FindSwitch(Key, SearchCase, false) != nullptr;
+}
+
+bool FCommandLine::Value(FStringView Key, FString& OutValue, ESearchCase SearchCase)
 {
-	TArray<FString> tokens;
-	FParse::Tokenize(s_CommandLine, tokens, false, false, ' ');
+	const FCommandLineSwitch* commandLineSwitch = FindSwitch(Key, SearchCase, true);
+	if (!commandLineSwitch)
+		return false;
 
-	return tokens;
+	OutValue = commandLineSwitch->Value;
+	return true;
 }
\ No newline at end of file
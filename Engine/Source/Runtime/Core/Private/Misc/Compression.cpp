@@ -0,0 +1,285 @@
+#include "Misc/Compression.h"
+
+#include "Memory/Memory.h"
+
+namespace LZ4
+{
+	// See https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+
+	constexpr int32 MinMatch = 4;
+
+	/** The last match has to start at least this many bytes before the end of the block. */
+	constexpr int32 MatchFindLimit = 12;
+
+	/** The last bytes of a block are always literals. */
+	constexpr int32 LastLiterals = 5;
+
+	constexpr int32 MaxOffset = 65535;
+
+	constexpr int32 HashBits = 12;
+
+	FORCEINLINE uint32 Read32(const uint8* Ptr)
+	{
+		uint32 value;
+		FMemory::Memcpy(&value, Ptr, sizeof(value));
+		return value;
+	}
+
+	FORCEINLINE uint32 Hash(uint32 Sequence)
+	{
+		return (Sequence * 2654435761u) >> (32 - HashBits);
+	}
+
+	/**
+	* Writes a length that didn't fit into its token nibble.
+	*/
+	FORCEINLINE void WriteLength(uint8*& Op, int32 Length)
+	{
+		for (; Length >= 255; Length -= 255)
+			*Op++ = 255;
+
+		*Op++ = static_cast<uint8>(Length);
+	}
+
+	/**
+	* Reads a length that didn't fit into its token nibble.
+	* @return false if the input ended.
+	*/
+	FORCEINLINE bool ReadLength(const uint8*& Ip, const uint8* InputEnd, int32& InOutLength)
+	{
+		uint8 value;
+		do
+		{
+			if (Ip >= InputEnd)
+				return false;
+
+			value = *Ip++;
+			InOutLength += value;
+		}
+		while (value == 255);
+
+		return InOutLength >= 0;
+	}
+
+	/**
+	* Writes a sequence of literals followed by a match, a match length of 0 writes the last literals only.
+	* @return false if the sequence doesn't fit.
+	*/
+	bool WriteSequence(uint8*& Op, const uint8* OutputEnd, const uint8* Literals, int32 NumLiterals, int32 Offset, int32 MatchLength)
+	{
+		const int64 required = 1 + (NumLiterals / 255 + 1) + NumLiterals + (MatchLength > 0 ? 2 + (MatchLength - MinMatch) / 255 + 1 : 0);
+		if (required > OutputEnd - Op)
+			return false;
+
+		uint8* token = Op++;
+		*token = static_cast<uint8>((NumLiterals >= 15 ? 15 : NumLiterals) << 4);
+
+		if (NumLiterals >= 15)
+			WriteLength(Op, NumLiterals - 15);
+
+		FMemory::Memcpy(Op, Literals, NumLiterals);
+		Op += NumLiterals;
+
+		if (MatchLength == 0)
+			return true;
+
+		*Op++ = static_cast<uint8>(Offset);
+		*Op++ = static_cast<uint8>(Offset >> 8);
+
+		const int32 matchCode = MatchLength - MinMatch;
+		*token |= static_cast<uint8>(matchCode >= 15 ? 15 : matchCode);
+
+		if (matchCode >= 15)
+			WriteLength(Op, matchCode - 15);
+
+		return true;
+	}
+
+	/**
+	* Greedy compressor with a single hash table entry per bucket.
+	* @return Size of the compressed data, 0 if it doesn't fit.
+	*/
+	int32 Compress(const uint8* Src, int32 SrcSize, uint8* Dst, int32 DstCapacity)
+	{
+		uint8* op = Dst;
+		const uint8* outputEnd = Dst + DstCapacity;
+
+		const uint8* anchor = Src;
+
+		if (SrcSize > MatchFindLimit)
+		{
+			// Positions of the last sequence with each hash, relative to Src
+			int32 table[1 << HashBits];
+			FMemory::Memset(table, 0xFF, sizeof(table));
+
+			const uint8* ip = Src;
+			const uint8* matchFindEnd = Src + SrcSize - MatchFindLimit;
+			const uint8* matchEnd = Src + SrcSize - LastLiterals;
+
+			while (ip < matchFindEnd)
+			{
+				const uint32 sequence = Read32(ip);
+				const uint32 hash = Hash(sequence);
+
+				const int32 candidate = table[hash];
+				table[hash] = static_cast<int32>(ip - Src);
+
+				if (candidate < 0 || ip - (Src + candidate) > MaxOffset || Read32(Src + candidate) != sequence)
+				{
+					++ip;
+					continue;
+				}
+
+				const uint8* match = Src + candidate;
+
+				// Extend the match backwards into the pending literals
+
+				while (ip > anchor && match > Src && ip[-1] == match[-1])
+				{
+					--ip;
+					--match;
+				}
+
+				int32 matchLength = MinMatch;
+				while (ip + matchLength < matchEnd && ip[matchLength] == match[matchLength])
+					++matchLength;
+
+				if (!WriteSequence(op, outputEnd, anchor, static_cast<int32>(ip - anchor), static_cast<int32>(ip - match), matchLength))
+					return 0;
+
+				ip += matchLength;
+				anchor = ip;
+			}
+		}
+
+		if (!WriteSequence(op, outputEnd, anchor, static_cast<int32>(Src + SrcSize - anchor), 0, 0))
+			return 0;
+
+		return static_cast<int32>(op - Dst);
+	}
+
+	bool Decompress(const uint8* Src, int32 SrcSize, uint8* Dst, int32 DstSize)
+	{
+		const uint8* ip = Src;
+		const uint8* inputEnd = Src + SrcSize;
+
+		uint8* op = Dst;
+		const uint8* outputEnd = Dst + DstSize;
+
+		while (ip < inputEnd)
+		{
+			const uint8 token = *ip++;
+
+			// Literals
+
+			int32 numLiterals = token >> 4;
+			if (numLiterals == 15 && !ReadLength(ip, inputEnd, numLiterals))
+				return false;
+
+			if (numLiterals > inputEnd - ip || numLiterals > outputEnd - op)
+				return false;
+
+			FMemory::Memcpy(op, ip, numLiterals);
+			ip += numLiterals;
+			op += numLiterals;
+
+			// The last sequence has no match
+
+			if (ip == inputEnd)
+				break;
+
+			// Match
+
+			if (inputEnd - ip < 2)
+				return false;
+
+			const int32 offset = ip[0] | (ip[1] << 8);
+			ip += 2;
+
+			if (offset == 0 || offset > op - Dst)
+				return false;
+
+			int32 matchLength = token & 15;
+			if (matchLength == 15 && !ReadLength(ip, inputEnd, matchLength))
+				return false;
+
+			matchLength += MinMatch;
+			if (matchLength > outputEnd - op)
+				return false;
+
+			const uint8* match = op - offset;
+
+			if (offset >= matchLength)
+			{
+				FMemory::Memcpy(op, match, matchLength);
+				op += matchLength;
+			}
+			else
+			{
+				// Overlapping match, repeats the last offset bytes
+				for (int32 i = 0; i < matchLength; ++i)
+					*op++ = *match++;
+			}
+		}
+
+		return op == outputEnd;
+	}
+}
+
+int32 FCompression::CompressMemoryBound(ECompressionMethod Method, int32 UncompressedSize)
+{
+	switch (Method)
+	{
+	case ECompressionMethod::LZ4:
+		return UncompressedSize + UncompressedSize / 255 + 16;
+	default:
+		return UncompressedSize;
+	}
+}
+
+bool FCompression::CompressMemory(ECompressionMethod Method, void* CompressedBuffer, int32& InOutCompressedSize, const void* UncompressedBuffer, int32 UncompressedSize)
+{
+	switch (Method)
+	{
+	case ECompressionMethod::None:
+	{
+		if (InOutCompressedSize < UncompressedSize)
+			return false;
+
+		FMemory::Memcpy(CompressedBuffer, UncompressedBuffer, UncompressedSize);
+		InOutCompressedSize = UncompressedSize;
+
+		return true;
+	}
+	case ECompressionMethod::LZ4:
+	{
+		const int32 compressedSize = LZ4::Compress(static_cast<const uint8*>(UncompressedBuffer), UncompressedSize, static_cast<uint8*>(CompressedBuffer), InOutCompressedSize);
+		if (compressedSize == 0)
+			return false;
+
+		InOutCompressedSize = compressedSize;
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool FCompression::UncompressMemory(ECompressionMethod Method, void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize)
+{
+	switch (Method)
+	{
+	case ECompressionMethod::None:
+	{
+		if (CompressedSize != UncompressedSize)
+			return false;
+
+		FMemory::Memcpy(UncompressedBuffer, CompressedBuffer, UncompressedSize);
+		return true;
+	}
+	case ECompressionMethod::LZ4:
+		return LZ4::Decompress(static_cast<const uint8*>(CompressedBuffer), CompressedSize, static_cast<uint8*>(UncompressedBuffer), UncompressedSize);
+	default:
+		return false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "Misc/Crc.h"
+
+#include "Memory/Memory.h"
+
+#if PLATFORM_WINDOWS && (PLATFORM_X64 || PLATFORM_X86)
+#include <intrin.h>
+#include <nmmintrin.h>
+#define IE_CRC32C_SSE42 1
+#else
+#define IE_CRC32C_SSE42 0
+#endif
+
+namespace
+{
+	/** Reflected CRC32C polynomial. */
+	constexpr uint32 Crc32CPolynomial = 0x82F63B78;
+
+	/**
+	* Tables for slicing-by-8, Tables[N][Byte] is the checksum of Byte followed by N zero bytes.
+	*/
+	struct FCrc32CTables
+	{
+		uint32 Tables[8][256] = {};
+
+		constexpr FCrc32CTables()
+		{
+			for (uint32 i = 0; i < 256; ++i)
+			{
+				uint32 crc = i;
+				for (int32 bit = 0; bit < 8; ++bit)
+					crc = (crc >> 1) ^ ((crc & 1) ? Crc32CPolynomial : 0);
+
+				Tables[0][i] = crc;
+			}
+
+			for (uint32 i = 0; i < 256; ++i)
+			{
+				for (int32 slice = 1; slice < 8; ++slice)
+					Tables[slice][i] = (Tables[slice - 1][i] >> 8) ^ Tables[0][Tables[slice - 1][i] & 0xFF];
+			}
+		}
+	};
+
+	constexpr FCrc32CTables Crc32CTables;
+
+	uint32 Crc32CTable(uint32 Crc, const uint8* Data, uint64 Size)
+	{
+		const uint32 (&tables)[8][256] = Crc32CTables.Tables;
+
+		for (; Size >= 8; Size -= 8, Data += 8)
+		{
+			uint32 low;
+			uint32 high;
+			FMemory::Memcpy(&low, Data, sizeof(low));
+			FMemory::Memcpy(&high, Data + 4, sizeof(high));
+
+			low ^= Crc;
+
+			Crc = tables[7][low & 0xFF] ^ tables[6][(low >> 8) & 0xFF] ^ tables[5][(low >> 16) & 0xFF] ^ tables[4][low >> 24]
+				^ tables[3][high & 0xFF] ^ tables[2][(high >> 8) & 0xFF] ^ tables[1][(high >> 16) & 0xFF] ^ tables[0][high >> 24];
+		}
+
+		for (; Size > 0; --Size, ++Data)
+			Crc = (Crc >> 8) ^ tables[0][(Crc ^ *Data) & 0xFF];
+
+		return Crc;
+	}
+
+#if IE_CRC32C_SSE42
+
+	bool SupportsSSE42()
+	{
+		int32 cpuInfo[4] = {};
+		__cpuid(cpuInfo, 1);
+
+		// ECX bit 20
+		return (cpuInfo[2] & (1 << 20)) != 0;
+	}
+
+	uint32 Crc32CSSE42(uint32 Crc, const uint8* Data, uint64 Size)
+	{
+		for (; Size > 0 && (reinterpret_cast<UPTRINT>(Data) & 7) != 0; --Size, ++Data)
+			Crc = _mm_crc32_u8(Crc, *Data);
+
+#if PLATFORM_X64
+		uint64 crc64 = Crc;
+		for (; Size >= 8; Size -= 8, Data += 8)
+			crc64 = _mm_crc32_u64(crc64, *reinterpret_cast<const uint64*>(Data));
+
+		Crc = static_cast<uint32>(crc64);
+#endif
+
+		for (; Size >= 4; Size -= 4, Data += 4)
+			Crc = _mm_crc32_u32(Crc, *reinterpret_cast<const uint32*>(Data));
+
+		for (; Size > 0; --Size, ++Data)
+			Crc = _mm_crc32_u8(Crc, *Data);
+
+		return Crc;
+	}
+
+#endif
+}
+
+uint32 FCrc::Crc32C(const void* Data, uint64 Size, uint32 Crc)
+{
+	const uint8* data = static_cast<const uint8*>(Data);
+
+	// Pre and post inversion, so checksums of consecutive blocks can be chained
+	Crc = ~Crc;
+
+#if IE_CRC32C_SSE42
+	static const bool bSupportsSSE42 = SupportsSSE42();
+	if (bSupportsSSE42)
+		return ~Crc32CSSE42(Crc, data, Size);
+#endif
+
+	return ~Crc32CTable(Crc, data, Size);
+}
\ No newline at end of file
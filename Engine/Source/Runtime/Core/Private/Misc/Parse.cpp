@@ -1,120 +1,88 @@
 #include "Misc/Parse.h"
 
+#include "Misc/Tokenizer.h"
+
 int32 FParse::Tokenize(const FString& InStr, TArray<FString>& OutTokens, bool bInAllowEmptyTokens, bool bInKeepQuotes, TCHAR InDelim, TCHAR InQuote)
 {
 	OutTokens.Empty();
 
-	const int32 StrLen = InStr.Length();
-	if (StrLen == 0)
-	{
-		return 0;
-	}
-
-	FString Token;
-	bool bInQuotes = false;
-	for (int32 CharIndex = 0; CharIndex < StrLen; ++CharIndex)
-	{
-		const TCHAR Char = InStr[CharIndex];
-		if (Char == InQuote)
-		{
-			if (bInKeepQuotes)
-			{
-				Token.InlineAppendChar(Char);
-			}
-			bInQuotes = !bInQuotes;
-		}
-		else if (Char == InDelim && !bInQuotes)
-		{
-			if (Token.Length() > 0 || bInAllowEmptyTokens)
-			{
-				OutTokens.Add(MoveTemp(Token));
-			}
-		}
-		else
-		{
-			Token.InlineAppendChar(Char);
-		}
-	}
-
-	if (Token.Length() > 0 || bInAllowEmptyTokens)
-	{
-		OutTokens.Add(MoveTemp(Token));
-	}
+	for (FStringView token : FTokenizer(InStr, bInAllowEmptyTokens, bInKeepQuotes, InDelim, InQuote))
+		OutTokens.Add(FString(token));
 
 	return OutTokens.Num();
 }
 
-bool FParse_Value_Parse_Value(const FString& InStr, int32 InEqualsIndex, FString& OutValue)
+namespace
 {
-	int32 startIndex = InEqualsIndex + 1;
-
-	// Find the start of the value
-
-	for (int32 i = startIndex; i < InStr.Length(); ++i)
+	// Parses the value after the equals sign, quoted values may contain white-space
+	bool ParseValueAfterEquals(FStringView InStr, int32 InEqualsIndex, FStringView& OutValue)
 	{
-		if (!TChar<TCHAR>::IsWhiteSpace(InStr[i]))
-		{
-			startIndex = i;
-			break;
-		}
-	}
+		const FStringView value = InStr.Mid(InEqualsIndex + 1, InStr.Length() - InEqualsIndex - 1).TrimStart(TEXT(" \t\r\n"));
 
-	if (InStr[startIndex] == '\"')
-	{
-		for (int32 i = startIndex + 1; i < InStr.Length(); ++i)
+		if (!value.IsEmpty() && value[0] == TEXT('\"'))
 		{
-			if (InStr[i] == '\"')
-			{
-				OutValue = InStr.Mid(startIndex + 1, i - startIndex - 1);
-				return true;
-			}
-		}
+			const int32 closingIndex = value.Mid(1, value.Length() - 1).FindChar(TEXT('\"'));
 
-		// No closing quote
+			// No closing quote
+			if (closingIndex == INDEX_NONE)
+				return false;
 
-		return false;
-	}
-	else
-	{
-		for (int32 i = startIndex; i < InStr.Length(); ++i)
-		{
-			if (TChar<TCHAR>::IsWhiteSpace(InStr[i]))
-			{
-				OutValue = InStr.Mid(startIndex, i - startIndex);
-				return true;
-			}
+			OutValue = value.Mid(1, closingIndex);
+			return true;
 		}
 
-		OutValue = InStr.Mid(startIndex, InStr.Length() - startIndex);
+		int32 length = 0;
+		while (length < value.Length() && !TChar<TCHAR>::IsWhiteSpace(value[length]))
+			++length;
+
+		OutValue = value.Left(length);
 		return true;
 	}
 }
 
-bool FParse::KeyValue(const FString& InStr, FString& OutKey, FString& OutValue)
+bool FParse::KeyValue(FStringView InStr, FString& OutKey, FString& OutValue)
 {
-	int32 equalsIndex = INDEX_NONE;
-	for (int32 i = 0; i < InStr.Length(); ++i)
-	{
-		if (InStr[i] == TEXT('='))
-		{
-			equalsIndex = i;
-			break;
-		}
-	}
+	FStringView key;
+	FStringView value;
 
+	if (!KeyValue(InStr, key, value))
+		return false;
+
+	OutKey = FString(key);
+	OutValue = FString(value);
+
+	return true;
+}
+
+bool FParse::KeyValue(FStringView InStr, FStringView& OutKey, FStringView& OutValue)
+{
+	const int32 equalsIndex = InStr.FindChar(TEXT('='));
 	if (equalsIndex == INDEX_NONE || equalsIndex == 0)
 		return false;
 
-	OutKey = InStr.Mid(0, equalsIndex);
-	return FParse_Value_Parse_Value(InStr, equalsIndex, OutValue);
+	OutKey = InStr.Left(equalsIndex);
+	return ParseValueAfterEquals(InStr, equalsIndex, OutValue);
 }
 
-bool FParse::Value(const FString& InStr, const FString& Key, FString& OutValue, ESearchCase SearchCase)
+bool FParse::Value(FStringView InStr, FStringView Key, FString& OutValue, ESearchCase SearchCase)
 {
+	FStringView value;
+	if (!Value(InStr, Key, value, SearchCase))
+		return false;
+
+	OutValue = FString(value);
+	return true;
+}
+
+bool FParse::Value(FStringView InStr, FStringView Key, FStringView& OutValue, ESearchCase SearchCase)
+{
+	if (Key.IsEmpty())
+		return false;
+
 	int32 keyIndex = INDEX_NONE;
 	for (int32 i = 0; i <= InStr.Length() - Key.Length(); ++i)
 	{
-		if (!TChar<TCHAR>::IsWhiteSpace(InStr[i]) && FPlatformString::Compare(&InStr[i], *Key, Key.Length(), SearchCase))
+		if (!TChar<TCHAR>::IsWhiteSpace(InStr[i]) && FPlatformString::Compare(InStr.GetData() + i, Key.GetData(), Key.Length(), SearchCase))
 		{
 			keyIndex = i;
 			break;
@@ -124,34 +92,26 @@ bool FParse::Value(const FString& InStr, const FString& Key, FString& OutValue,
 	if (keyIndex == INDEX_NONE)
 		return false;
 
-	int32 equalsIndex = INDEX_NONE;
-	for (int32 i = keyIndex + Key.Length(); i < InStr.Length(); ++i)
-	{
-		if (InStr[i] == TEXT('='))
-		{
-			equalsIndex = i;
-			break;
-		}
-	}
+	const int32 afterKeyIndex = keyIndex + Key.Length();
+	const int32 equalsIndex = InStr.Mid(afterKeyIndex, InStr.Length() - afterKeyIndex).FindChar(TEXT('='));
 
 	if (equalsIndex == INDEX_NONE)
 		return false;
 
-	return FParse_Value_Parse_Value(InStr, equalsIndex, OutValue);
+	return ParseValueAfterEquals(InStr, afterKeyIndex + equalsIndex, OutValue);
 }
 
-bool FParse::Param(const FString& InStr, const FString& Key, ESearchCase SearchCase)
+bool FParse::Param(FStringView InStr, FStringView Key, ESearchCase SearchCase)
 {
-	for(int32 i = 0; i <= InStr.Length() - Key.Length(); ++i)
+	for(int32 i = 0; i < InStr.Length() - Key.Length(); ++i)
 	{
-		const TCHAR character = InStr[i];
-		if (TChar<TCHAR>::IsWhiteSpace(character) || character != '-')
+		if (InStr[i] != '-' || !FPlatformString::Compare(InStr.GetData() + i + 1, Key.GetData(), Key.Length(), SearchCase))
 			continue;
 
-		if (FPlatformString::Compare(&InStr[i + 1], *Key, Key.Length(), SearchCase))
+		// The key has to be the whole parameter name, -KeyLonger isn't the parameter Key
+		const int32 keyEnd = i + 1 + Key.Length();
+		if (keyEnd == InStr.Length() || TChar<TCHAR>::IsWhiteSpace(InStr[keyEnd]) || InStr[keyEnd] == '=')
 			return true;
-
-		i += Key.Length();
 	}
 
 	return false;
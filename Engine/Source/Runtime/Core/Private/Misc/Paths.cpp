@@ -9,73 +9,68 @@
 const TCHAR FPaths::DefaultDirectorySeparator = TEXT('\\');
 const FString FPaths::DirectorySeparatorChars = TEXT("\\/");
 
-void FPaths::Split(const FString& InPath, TArray<FString>& OutPaths, bool bFullPath)
+namespace
 {
-	OutPaths.Empty(1);
-
-	const TCHAR* start = *InPath;
-	const TCHAR* end = start + InPath.Length();
-
-	TCHAR* str = const_cast<TCHAR*>(start);
-
-	while (str != end)
+	// @return Index of the last directory separator in the path, or INDEX_NONE
+	int32 FindLastSeparator(FStringView InPath)
 	{
-		if (DirectorySeparatorChars.ContainsChar(*(str++)))
+		for (int32 i = InPath.Length() - 1; i >= 0; --i)
 		{
-			const int32 length = static_cast<int32>(str - start) - 1;
-			if (length > 0)
-			{
-				if (bFullPath)
-					OutPaths.Add(InPath.Left(length));
-				else
-					OutPaths.Add(GetFilename(InPath.Left(length)));
-			}
+			if (FPaths::DirectorySeparatorChars.ContainsChar(InPath[i]))
+				return i;
 		}
-	}
 
+		return INDEX_NONE;
+	}
 
-	if (bFullPath)
-		OutPaths.Add(InPath);
-	else
-		OutPaths.Add(GetFilename(InPath));
+	FStringView GetFilenameView(FStringView InPath)
+	{
+		const int32 separatorIndex = FindLastSeparator(InPath);
+		return separatorIndex == INDEX_NONE ? InPath : InPath.Right(separatorIndex);
+	}
 }
 
-FString FPaths::GetPathParent(const FString& InPath)
+void FPaths::Split(FStringView InPath, TArray<FString>& OutPaths, bool bFullPath)
 {
-	for (int32 i = InPath.Length() - 1; i >= 0; --i)
+	OutPaths.Empty(1);
+
+	for (int32 i = 0; i < InPath.Length(); ++i)
 	{
-		if (DirectorySeparatorChars.ContainsChar(InPath[i]))
-			return InPath.Left(i);
+		if (i > 0 && DirectorySeparatorChars.ContainsChar(InPath[i]))
+		{
+			const FStringView path = InPath.Left(i);
+			OutPaths.Add(FString(bFullPath ? path : GetFilenameView(path)));
+		}
 	}
 
-	return FString();
+	OutPaths.Add(FString(bFullPath ? InPath : GetFilenameView(InPath)));
 }
 
-FString FPaths::GetFilename(const FString& InPath)
+FString FPaths::GetPathParent(FStringView InPath)
 {
-	for (int32 i = InPath.Length() - 1; i >= 0; --i)
-	{
-		if (DirectorySeparatorChars.ContainsChar(InPath[i]))
-			return InPath.Right(i);
-	}
+	const int32 separatorIndex = FindLastSeparator(InPath);
+	return separatorIndex == INDEX_NONE ? FString() : FString(InPath.Left(separatorIndex));
+}
 
-	return InPath;
+FString FPaths::GetFilename(FStringView InPath)
+{
+	return FString(GetFilenameView(InPath));
 }
 
-FString FPaths::GetFilenameWithoutExtension(const FString& InPath)
+FString FPaths::GetFilenameWithoutExtension(FStringView InPath)
 {
-	FString filename = GetFilename(InPath);
-	const int32 dotIndex = filename.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	const FStringView filename = GetFilenameView(InPath);
+	const int32 dotIndex = filename.FindLastChar(TEXT('.'));
 
-	return dotIndex == INDEX_NONE ? filename : filename.Left(dotIndex);
+	return FString(dotIndex == INDEX_NONE ? filename : filename.Left(dotIndex));
 }
 
-FString FPaths::GetExtension(const FString& InPath)
+FString FPaths::GetExtension(FStringView InPath)
 {
-	FString filename = GetFilename(InPath);
-	const int32 dotIndex = filename.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	const FStringView filename = GetFilenameView(InPath);
+	const int32 dotIndex = filename.FindLastChar(TEXT('.'));
 
-	return dotIndex == INDEX_NONE ? FString() : filename.Right(dotIndex);
+	return dotIndex == INDEX_NONE ? FString() : FString(filename.Right(dotIndex));
 }
 
 FString FPaths::MakePathRelativeTo(const FString& InPath, const FString& InBasePath)
@@ -102,23 +97,23 @@ FString FPaths::MakePathRelativeTo(const FString& InPath, const FString& InBaseP
 
 	const int32 numStepsBack = basePathParts.Num() - samePathIndex - 1;
 
-	FString relativePath;
+	TStringBuilder<IE_PATHS_BUILDER_SIZE> relativePath;
 	for (int32 i = 0; i < numStepsBack; ++i)
-		relativePath.InlineAppend(FString(TEXT("..")) + DefaultDirectorySeparator);
+		relativePath.Append(TEXT("..")).AppendChar(DefaultDirectorySeparator);
 
 	for (int32 i = samePathIndex + 1; i < pathParts.Num(); ++i)
 	{
-		relativePath.InlineAppend(pathParts[i]);
+		relativePath.Append(pathParts[i]);
 		if (i < pathParts.Num() - 1)
-			relativePath.InlineAppendChar(DefaultDirectorySeparator);
+			relativePath.AppendChar(DefaultDirectorySeparator);
 	}
 
-	return relativePath;
+	return relativePath.ToString();
 }
 
 FString FPaths::MakePathAbsolute(const FString& InPath, const FString& InBasePath)
 {
-	FString absolutePath = InBasePath;
+	TStringBuilder<IE_PATHS_BUILDER_SIZE> absolutePath(InBasePath);
 	
 	TArray<FString> paths;
 	Split(InPath, paths, false);
@@ -126,12 +121,18 @@ FString FPaths::MakePathAbsolute(const FString& InPath, const FString& InBasePat
 	for (int32 i = 0; i < paths.Num(); ++i)
 	{
 		if (paths[i] == TEXT(".."))
-			absolutePath = GetPathParent(absolutePath);
+		{
+			// Same as GetPathParent, the path becomes empty if it has no separator
+			const int32 separatorIndex = FindLastSeparator(absolutePath);
+			absolutePath.RemoveSuffix(absolutePath.Length() - (separatorIndex == INDEX_NONE ? 0 : separatorIndex));
+		}
 		else
-			absolutePath = Combine(absolutePath, paths[i]);
+		{
+			absolutePath.AppendChar(DefaultDirectorySeparator).Append(paths[i]);
+		}
 	}
 
-	return absolutePath;
+	return absolutePath.ToString();
 }
 
 FString FPaths::ExecutableDir()
@@ -206,14 +207,14 @@ FString FPaths::GameLogDir()
 
 FString FPaths::Combine(const TArray<FString>& InPaths)
 {
-	FString combinedPath;
+	TStringBuilder<IE_PATHS_BUILDER_SIZE> combinedPath;
 
 	for (int32 i = 0; i < InPaths.Num(); ++i)
 	{
-		combinedPath.InlineAppend(InPaths[i]);
+		combinedPath.Append(InPaths[i]);
 		if (i < InPaths.Num() - 1)
-			combinedPath.InlineAppendChar(DefaultDirectorySeparator);
+			combinedPath.AppendChar(DefaultDirectorySeparator);
 	}
 
-	return combinedPath;
+	return combinedPath.ToString();
 }
\ No newline at end of file
@@ -10,14 +10,14 @@ void FThreadSafeCounter::AddWeakRef()
 	FPlatformAtomics::InterlockedIncrement(&WeakCounter);
 }
 
-void FThreadSafeCounter::Release()
+int32 FThreadSafeCounter::Release()
 {
-	FPlatformAtomics::InterlockedDecrement(&Counter);
+	return FPlatformAtomics::InterlockedDecrement(&Counter);
 }
 
-void FThreadSafeCounter::ReleaseWeakRef()
+int32 FThreadSafeCounter::ReleaseWeakRef()
 {
-	FPlatformAtomics::InterlockedDecrement(&WeakCounter);
+	return FPlatformAtomics::InterlockedDecrement(&WeakCounter);
 }
 
 int32 FThreadSafeCounter::GetRefCount() const
@@ -45,14 +45,14 @@ void FNotThreadSafeCounter::AddWeakRef()
 	++WeakCounter;
 }
 
-void FNotThreadSafeCounter::Release()
+int32 FNotThreadSafeCounter::Release()
 {
-	--Counter;
+	return --Counter;
 }
 
-void FNotThreadSafeCounter::ReleaseWeakRef()
+int32 FNotThreadSafeCounter::ReleaseWeakRef()
 {
-	--WeakCounter;
+	return --WeakCounter;
 }
 
 int32 FNotThreadSafeCounter::GetRefCount() const
@@ -0,0 +1,789 @@
+#include "Misc/StringSearch.h"
+
+#include "Memory/Memory.h"
+#include "Misc/Char.h"
+#include "Text/CaseFolding.h"
+
+#if PLATFORM_WINDOWS && (PLATFORM_X64 || PLATFORM_X86)
+#include <intrin.h>
+#include <immintrin.h>
+#define IE_STRING_SEARCH_SIMD 1
+#else
+#define IE_STRING_SEARCH_SIMD 0
+#endif
+
+// Max number of characters of a set that are compared a vector at a time, larger sets are scanned one character at a time
+#define IE_STRING_SEARCH_MAX_VECTOR_SET 16
+
+namespace
+{
+	template<int32 Size>
+	struct TCharUnit;
+
+	template<> struct TCharUnit<1> { typedef uint8 Type; };
+	template<> struct TCharUnit<2> { typedef uint16 Type; };
+	template<> struct TCharUnit<4> { typedef uint32 Type; };
+
+	template<typename CharType>
+	FORCEINLINE const typename TCharUnit<sizeof(CharType)>::Type* ToUnits(const CharType* InData)
+	{
+		return reinterpret_cast<const typename TCharUnit<sizeof(CharType)>::Type*>(InData);
+	}
+
+	// Instruction set without vectors, the kernels only run their scalar loops
+	struct FScalar
+	{
+		typedef int32 FVector;
+		static constexpr int32 Size = 0;
+	};
+
+	// Index of the lowest set bit of a non-zero mask
+	FORCEINLINE int32 LowestBit(uint32 Mask)
+	{
+#if IE_STRING_SEARCH_SIMD
+		unsigned long index;
+		_BitScanForward(&index, Mask);
+		return static_cast<int32>(index);
+#else
+		int32 index = 0;
+		for (; (Mask & 1) == 0; Mask >>= 1)
+			++index;
+
+		return index;
+#endif
+	}
+
+	// Index of the highest set bit of a non-zero mask
+	FORCEINLINE int32 HighestBit(uint32 Mask)
+	{
+#if IE_STRING_SEARCH_SIMD
+		unsigned long index;
+		_BitScanReverse(&index, Mask);
+		return static_cast<int32>(index);
+#else
+		int32 index = 31;
+		for (; (Mask & 0x80000000u) == 0; Mask <<= 1)
+			--index;
+
+		return index;
+#endif
+	}
+
+#if IE_STRING_SEARCH_SIMD
+
+	struct FSSE2
+	{
+		typedef __m128i FVector;
+		static constexpr int32 Size = 16;
+
+		static FORCEINLINE FVector Load(const void* InData) { return _mm_loadu_si128(static_cast<const __m128i*>(InData)); }
+		static FORCEINLINE FVector LoadAligned(const void* InData) { return _mm_load_si128(static_cast<const __m128i*>(InData)); }
+		static FORCEINLINE void Store(void* OutData, FVector InVector) { _mm_storeu_si128(static_cast<__m128i*>(OutData), InVector); }
+		static FORCEINLINE FVector And(FVector A, FVector B) { return _mm_and_si128(A, B); }
+		static FORCEINLINE FVector Or(FVector A, FVector B) { return _mm_or_si128(A, B); }
+
+		// One bit per byte
+		static FORCEINLINE uint32 Mask(FVector InVector) { return static_cast<uint32>(_mm_movemask_epi8(InVector)); }
+		static constexpr uint32 FullMask = 0xFFFF;
+
+		template<typename UnitType>
+		static FORCEINLINE FVector Splat(UnitType InUnit)
+		{
+			if constexpr (sizeof(UnitType) == 1)
+				return _mm_set1_epi8(static_cast<char>(InUnit));
+			else if constexpr (sizeof(UnitType) == 2)
+				return _mm_set1_epi16(static_cast<short>(InUnit));
+			else
+				return _mm_set1_epi32(static_cast<int>(InUnit));
+		}
+
+		template<typename UnitType>
+		static FORCEINLINE FVector Equal(FVector A, FVector B)
+		{
+			if constexpr (sizeof(UnitType) == 1)
+				return _mm_cmpeq_epi8(A, B);
+			else if constexpr (sizeof(UnitType) == 2)
+				return _mm_cmpeq_epi16(A, B);
+			else
+				return _mm_cmpeq_epi32(A, B);
+		}
+
+		template<typename UnitType>
+		static FORCEINLINE FVector Add(FVector A, FVector B)
+		{
+			if constexpr (sizeof(UnitType) == 1)
+				return _mm_add_epi8(A, B);
+			else if constexpr (sizeof(UnitType) == 2)
+				return _mm_add_epi16(A, B);
+			else
+				return _mm_add_epi32(A, B);
+		}
+
+		// Compares the units as signed values
+		template<typename UnitType>
+		static FORCEINLINE FVector Less(FVector A, FVector B)
+		{
+			if constexpr (sizeof(UnitType) == 1)
+				return _mm_cmplt_epi8(A, B);
+			else if constexpr (sizeof(UnitType) == 2)
+				return _mm_cmplt_epi16(A, B);
+			else
+				return _mm_cmplt_epi32(A, B);
+		}
+	};
+
+	struct FAVX2
+	{
+		typedef __m256i FVector;
+		static constexpr int32 Size = 32;
+
+		static FORCEINLINE FVector Load(const void* InData) { return _mm256_loadu_si256(static_cast<const __m256i*>(InData)); }
+		static FORCEINLINE FVector LoadAligned(const void* InData) { return _mm256_load_si256(static_cast<const __m256i*>(InData)); }
+		static FORCEINLINE void Store(void* OutData, FVector InVector) { _mm256_storeu_si256(static_cast<__m256i*>(OutData), InVector); }
+		static FORCEINLINE FVector And(FVector A, FVector B) { return _mm256_and_si256(A, B); }
+		static FORCEINLINE FVector Or(FVector A, FVector B) { return _mm256_or_si256(A, B); }
+
+		// One bit per byte
+		static FORCEINLINE uint32 Mask(FVector InVector) { return static_cast<uint32>(_mm256_movemask_epi8(InVector)); }
+		static constexpr uint32 FullMask = 0xFFFFFFFF;
+
+		template<typename UnitType>
+		static FORCEINLINE FVector Splat(UnitType InUnit)
+		{
+			if constexpr (sizeof(UnitType) == 1)
+				return _mm256_set1_epi8(static_cast<char>(InUnit));
+			else if constexpr (sizeof(UnitType) == 2)
+				return _mm256_set1_epi16(static_cast<short>(InUnit));
+			else
+				return _mm256_set1_epi32(static_cast<int>(InUnit));
+		}
+
+		template<typename UnitType>
+		static FORCEINLINE FVector Equal(FVector A, FVector B)
+		{
+			if constexpr (sizeof(UnitType) == 1)
+				return _mm256_cmpeq_epi8(A, B);
+			else if constexpr (sizeof(UnitType) == 2)
+				return _mm256_cmpeq_epi16(A, B);
+			else
+				return _mm256_cmpeq_epi32(A, B);
+		}
+
+		template<typename UnitType>
+		static FORCEINLINE FVector Add(FVector A, FVector B)
+		{
+			if constexpr (sizeof(UnitType) == 1)
+				return _mm256_add_epi8(A, B);
+			else if constexpr (sizeof(UnitType) == 2)
+				return _mm256_add_epi16(A, B);
+			else
+				return _mm256_add_epi32(A, B);
+		}
+
+		// Compares the units as signed values
+		template<typename UnitType>
+		static FORCEINLINE FVector Less(FVector A, FVector B)
+		{
+			if constexpr (sizeof(UnitType) == 1)
+				return _mm256_cmpgt_epi8(B, A);
+			else if constexpr (sizeof(UnitType) == 2)
+				return _mm256_cmpgt_epi16(B, A);
+			else
+				return _mm256_cmpgt_epi32(B, A);
+		}
+	};
+
+	bool SupportsAVX2()
+	{
+		int32 cpuInfo[4] = {};
+		__cpuid(cpuInfo, 0);
+		if (cpuInfo[0] < 7)
+			return false;
+
+		// OSXSAVE and AVX (ECX bits 27 and 28), and the OS saves the upper halves of the YMM registers
+		__cpuid(cpuInfo, 1);
+		if ((cpuInfo[2] & (3 << 27)) != (3 << 27) || (_xgetbv(0) & 6) != 6)
+			return false;
+
+		// EBX bit 5
+		__cpuidex(cpuInfo, 7, 0);
+		return (cpuInfo[1] & (1 << 5)) != 0;
+	}
+
+	FORCEINLINE bool UseAVX2()
+	{
+		static const bool bSupportsAVX2 = SupportsAVX2();
+		return bSupportsAVX2;
+	}
+
+#endif
+
+	/**
+	* Runs a kernel with the widest instruction set the CPU supports.
+	* @param Kernel - Lambda with the instruction set as its template parameter.
+	*/
+	template<typename KernelType>
+	FORCEINLINE int32 Dispatch(const KernelType& Kernel)
+	{
+#if IE_STRING_SEARCH_SIMD
+		if (UseAVX2())
+		{
+			const int32 result = Kernel.template operator()<FAVX2>();
+
+			// Avoids the penalty of mixing AVX and SSE instructions in the caller
+			_mm256_zeroupper();
+			return result;
+		}
+
+		return Kernel.template operator()<FSSE2>();
+#else
+		return Kernel.template operator()<FScalar>();
+#endif
+	}
+
+	template<typename VecType, typename UnitType>
+	struct TCharMatcher
+	{
+		explicit TCharMatcher(UnitType InChar)
+			: Char(InChar)
+		{
+			if constexpr (VecType::Size > 0)
+				CharVector = VecType::template Splat<UnitType>(InChar);
+		}
+
+		FORCEINLINE uint32 Mask(typename VecType::FVector InVector) const
+		{
+			return VecType::Mask(VecType::template Equal<UnitType>(InVector, CharVector));
+		}
+
+		FORCEINLINE bool Matches(UnitType InUnit) const
+		{
+			return InUnit == Char;
+		}
+
+		typename VecType::FVector CharVector = {};
+		UnitType Char;
+	};
+
+	template<typename VecType, typename UnitType, bool bNegate>
+	struct TSetMatcher
+	{
+		TSetMatcher(const UnitType* InChars, int32 InNumChars)
+			: Chars(InChars)
+			, NumChars(InNumChars)
+		{
+			if constexpr (VecType::Size > 0)
+			{
+				for (int32 i = 0; i < NumChars; ++i)
+					CharVectors[i] = VecType::template Splat<UnitType>(InChars[i]);
+			}
+		}
+
+		FORCEINLINE uint32 Mask(typename VecType::FVector InVector) const
+		{
+			typename VecType::FVector equal = VecType::template Equal<UnitType>(InVector, CharVectors[0]);
+			for (int32 i = 1; i < NumChars; ++i)
+				equal = VecType::Or(equal, VecType::template Equal<UnitType>(InVector, CharVectors[i]));
+
+			// All bytes of a character compare the same, so inverting keeps whole characters
+			return bNegate ? ~VecType::Mask(equal) & VecType::FullMask : VecType::Mask(equal);
+		}
+
+		FORCEINLINE bool Matches(UnitType InUnit) const
+		{
+			for (int32 i = 0; i < NumChars; ++i)
+			{
+				if (Chars[i] == InUnit)
+					return !bNegate;
+			}
+
+			return bNegate;
+		}
+
+		typename VecType::FVector CharVectors[VecType::Size > 0 ? IE_STRING_SEARCH_MAX_VECTOR_SET : 1];
+		const UnitType* Chars;
+		int32 NumChars;
+	};
+
+	template<typename VecType, typename UnitType, typename MatcherType>
+	FORCEINLINE int32 ScanForward(const UnitType* Data, int32 Length, const MatcherType& Matcher)
+	{
+		int32 i = 0;
+
+		if constexpr (VecType::Size > 0)
+		{
+			constexpr int32 unitsPerVector = VecType::Size / sizeof(UnitType);
+
+			for (; i + unitsPerVector <= Length; i += unitsPerVector)
+			{
+				const uint32 mask = Matcher.Mask(VecType::Load(Data + i));
+				if (mask != 0)
+					return i + LowestBit(mask) / static_cast<int32>(sizeof(UnitType));
+			}
+		}
+
+		for (; i < Length; ++i)
+		{
+			if (Matcher.Matches(Data[i]))
+				return i;
+		}
+
+		return INDEX_NONE;
+	}
+
+	template<typename VecType, typename UnitType, typename MatcherType>
+	FORCEINLINE int32 ScanBackward(const UnitType* Data, int32 Length, const MatcherType& Matcher)
+	{
+		int32 end = Length;
+
+		if constexpr (VecType::Size > 0)
+		{
+			constexpr int32 unitsPerVector = VecType::Size / sizeof(UnitType);
+
+			for (; end >= unitsPerVector; end -= unitsPerVector)
+			{
+				const uint32 mask = Matcher.Mask(VecType::Load(Data + end - unitsPerVector));
+				if (mask != 0)
+					return end - unitsPerVector + HighestBit(mask) / static_cast<int32>(sizeof(UnitType));
+			}
+		}
+
+		for (int32 i = end - 1; i >= 0; --i)
+		{
+			if (Matcher.Matches(Data[i]))
+				return i;
+		}
+
+		return INDEX_NONE;
+	}
+
+	// Compares the characters between the first and the last one, the candidate already matched those
+	template<typename UnitType>
+	FORCEINLINE bool MatchesInner(const UnitType* Data, const UnitType* SubStr, int32 SubStrLength)
+	{
+		return FMemory::Memcmp(Data + 1, SubStr + 1, static_cast<size_t>(SubStrLength - 2) * sizeof(UnitType)) == 0;
+	}
+
+	/**
+	* Finds a substring of at least two characters that isn't longer than the data.
+	* A vector of positions is compared with the first character of the substring and the vector shifted by
+	* the length of the substring with its last character, only positions that match both are compared in full.
+	*/
+	template<typename VecType, typename UnitType>
+	FORCEINLINE int32 FindSubstring(const UnitType* Data, int32 Length, const UnitType* SubStr, int32 SubStrLength)
+	{
+		const int32 lastStart = Length - SubStrLength;
+		const UnitType first = SubStr[0];
+		const UnitType last = SubStr[SubStrLength - 1];
+
+		int32 i = 0;
+
+		if constexpr (VecType::Size > 0)
+		{
+			constexpr int32 unitsPerVector = VecType::Size / sizeof(UnitType);
+			constexpr uint32 unitMask = (1u << sizeof(UnitType)) - 1;
+
+			const typename VecType::FVector firstVector = VecType::template Splat<UnitType>(first);
+			const typename VecType::FVector lastVector = VecType::template Splat<UnitType>(last);
+
+			for (; i + unitsPerVector - 1 <= lastStart; i += unitsPerVector)
+			{
+				const typename VecType::FVector firstEqual = VecType::template Equal<UnitType>(VecType::Load(Data + i), firstVector);
+				const typename VecType::FVector lastEqual = VecType::template Equal<UnitType>(VecType::Load(Data + i + SubStrLength - 1), lastVector);
+
+				for (uint32 mask = VecType::Mask(VecType::And(firstEqual, lastEqual)); mask != 0;)
+				{
+					const int32 bit = LowestBit(mask);
+					const int32 candidate = i + bit / static_cast<int32>(sizeof(UnitType));
+
+					if (MatchesInner(Data + candidate, SubStr, SubStrLength))
+						return candidate;
+
+					mask &= ~(unitMask << bit);
+				}
+			}
+		}
+
+		for (; i <= lastStart; ++i)
+		{
+			if (Data[i] == first && Data[i + SubStrLength - 1] == last && MatchesInner(Data + i, SubStr, SubStrLength))
+				return i;
+		}
+
+		return INDEX_NONE;
+	}
+
+	// Same as FindSubstring, from the end
+	template<typename VecType, typename UnitType>
+	FORCEINLINE int32 FindLastSubstring(const UnitType* Data, int32 Length, const UnitType* SubStr, int32 SubStrLength)
+	{
+		const UnitType first = SubStr[0];
+		const UnitType last = SubStr[SubStrLength - 1];
+
+		// Positions before it can still be the start of an occurrence
+		int32 end = Length - SubStrLength + 1;
+
+		if constexpr (VecType::Size > 0)
+		{
+			constexpr int32 unitsPerVector = VecType::Size / sizeof(UnitType);
+			constexpr uint32 unitMask = (1u << sizeof(UnitType)) - 1;
+
+			const typename VecType::FVector firstVector = VecType::template Splat<UnitType>(first);
+			const typename VecType::FVector lastVector = VecType::template Splat<UnitType>(last);
+
+			for (; end >= unitsPerVector; end -= unitsPerVector)
+			{
+				const int32 blockStart = end - unitsPerVector;
+
+				const typename VecType::FVector firstEqual = VecType::template Equal<UnitType>(VecType::Load(Data + blockStart), firstVector);
+				const typename VecType::FVector lastEqual = VecType::template Equal<UnitType>(VecType::Load(Data + blockStart + SubStrLength - 1), lastVector);
+
+				for (uint32 mask = VecType::Mask(VecType::And(firstEqual, lastEqual)); mask != 0;)
+				{
+					const int32 unitIndex = HighestBit(mask) / static_cast<int32>(sizeof(UnitType));
+					const int32 candidate = blockStart + unitIndex;
+
+					if (MatchesInner(Data + candidate, SubStr, SubStrLength))
+						return candidate;
+
+					mask &= ~(unitMask << (unitIndex * sizeof(UnitType)));
+				}
+			}
+		}
+
+		for (int32 i = end - 1; i >= 0; --i)
+		{
+			if (Data[i] == first && Data[i + SubStrLength - 1] == last && MatchesInner(Data + i, SubStr, SubStrLength))
+				return i;
+		}
+
+		return INDEX_NONE;
+	}
+
+	// The address sanitizer reports the bytes read around the string, so it gets the scalar loop
+#if defined(__SANITIZE_ADDRESS__)
+	constexpr bool bVectorTerminatorSearch = false;
+#else
+	constexpr bool bVectorTerminatorSearch = true;
+#endif
+
+	/**
+	* Finds the null terminator with aligned loads.
+	* An aligned load never crosses a page boundary, so reading the bytes around the string can't fault.
+	*/
+	template<typename VecType, typename UnitType>
+	int32 FindTerminator(const UnitType* String)
+	{
+		if constexpr (VecType::Size > 0 && bVectorTerminatorSearch)
+		{
+			constexpr int32 unitsPerVector = VecType::Size / sizeof(UnitType);
+			const UPTRINT address = reinterpret_cast<UPTRINT>(String);
+
+			// The characters have to line up with the vector's lanes
+			if (address % sizeof(UnitType) == 0)
+			{
+				const typename VecType::FVector zero = VecType::template Splat<UnitType>(0);
+				const UnitType* block = reinterpret_cast<const UnitType*>(address & ~static_cast<UPTRINT>(VecType::Size - 1));
+
+				// Skips the bytes before the string
+				uint32 mask = VecType::Mask(VecType::template Equal<UnitType>(VecType::LoadAligned(block), zero)) >> (address - reinterpret_cast<UPTRINT>(block));
+				if (mask != 0)
+					return LowestBit(mask) / static_cast<int32>(sizeof(UnitType));
+
+				for (block += unitsPerVector;; block += unitsPerVector)
+				{
+					mask = VecType::Mask(VecType::template Equal<UnitType>(VecType::LoadAligned(block), zero));
+					if (mask != 0)
+						return static_cast<int32>(block - String) + LowestBit(mask) / static_cast<int32>(sizeof(UnitType));
+				}
+			}
+		}
+
+		int32 length = 0;
+		while (String[length] != 0)
+			++length;
+
+		return length;
+	}
+
+	// Folds the ASCII upper case letters of a vector to lower case
+	template<typename VecType, typename UnitType>
+	FORCEINLINE typename VecType::FVector FoldAscii(typename VecType::FVector InVector)
+	{
+		// Moves 'A' to 'Z' to the lowest signed values, so a single signed comparison finds them
+		constexpr UnitType signBit = static_cast<UnitType>(UnitType(1) << (sizeof(UnitType) * 8 - 1));
+
+		const typename VecType::FVector shifted = VecType::template Add<UnitType>(InVector, VecType::template Splat<UnitType>(static_cast<UnitType>(signBit - 'A')));
+		const typename VecType::FVector upper = VecType::template Less<UnitType>(shifted, VecType::template Splat<UnitType>(static_cast<UnitType>(signBit + 26)));
+
+		return VecType::Or(InVector, VecType::And(upper, VecType::template Splat<UnitType>(static_cast<UnitType>('a' - 'A'))));
+	}
+
+	// Converts the ASCII lower case letters of a vector to upper case, like TChar::ToUpper
+	template<typename VecType, typename UnitType>
+	FORCEINLINE typename VecType::FVector ToUpperAsciiVector(typename VecType::FVector InVector)
+	{
+		constexpr UnitType signBit = static_cast<UnitType>(UnitType(1) << (sizeof(UnitType) * 8 - 1));
+
+		const typename VecType::FVector shifted = VecType::template Add<UnitType>(InVector, VecType::template Splat<UnitType>(static_cast<UnitType>(signBit - 'a')));
+		const typename VecType::FVector lower = VecType::template Less<UnitType>(shifted, VecType::template Splat<UnitType>(static_cast<UnitType>(signBit + 26)));
+
+		return VecType::template Add<UnitType>(InVector, VecType::And(lower, VecType::template Splat<UnitType>(static_cast<UnitType>('A' - 'a'))));
+	}
+
+	template<typename VecType, typename CharType>
+	FORCEINLINE void ToUpperAsciiKernel(const CharType* Source, CharType* Dest, int32 Length)
+	{
+		typedef typename TCharUnit<sizeof(CharType)>::Type FUnit;
+
+		int32 i = 0;
+
+		if constexpr (VecType::Size > 0)
+		{
+			constexpr int32 unitsPerVector = VecType::Size / sizeof(FUnit);
+
+			for (; i + unitsPerVector <= Length; i += unitsPerVector)
+				VecType::Store(Dest + i, ToUpperAsciiVector<VecType, FUnit>(VecType::Load(Source + i)));
+		}
+
+		for (; i < Length; ++i)
+			Dest[i] = TChar<CharType>::ToUpper(Source[i]);
+	}
+
+	// Compares with the folding of TChar::ToUpper, which is also the folding of Strihash
+	template<typename VecType, typename CharType>
+	FORCEINLINE bool EqualsIgnoreCaseAsciiKernel(const CharType* A, const CharType* B, int32 Length)
+	{
+		typedef typename TCharUnit<sizeof(CharType)>::Type FUnit;
+
+		int32 i = 0;
+
+		if constexpr (VecType::Size > 0)
+		{
+			constexpr int32 unitsPerVector = VecType::Size / sizeof(FUnit);
+
+			for (; i + unitsPerVector <= Length; i += unitsPerVector)
+			{
+				const typename VecType::FVector a = ToUpperAsciiVector<VecType, FUnit>(VecType::Load(A + i));
+				const typename VecType::FVector b = ToUpperAsciiVector<VecType, FUnit>(VecType::Load(B + i));
+
+				if (VecType::Mask(VecType::template Equal<FUnit>(a, b)) != VecType::FullMask)
+					return false;
+			}
+		}
+
+		for (; i < Length; ++i)
+		{
+			if (A[i] != B[i] && TChar<CharType>::ToUpper(A[i]) != TChar<CharType>::ToUpper(B[i]))
+				return false;
+		}
+
+		return true;
+	}
+
+	template<typename CharType>
+	FORCEINLINE bool EqualsFolded(const CharType* A, const CharType* B, int32 Start, int32 End)
+	{
+		for (int32 i = Start; i < End; ++i)
+		{
+			if (A[i] != B[i] && FCaseFolding::Fold(A[i]) != FCaseFolding::Fold(B[i]))
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	* Compares vectors with their ASCII letters folded.
+	* Only a vector that still differs is folded one character at a time, UTF-8 units fold nothing but ASCII so they differ right away.
+	*/
+	template<typename VecType, typename CharType>
+	FORCEINLINE bool EqualsIgnoreCaseKernel(const CharType* A, const CharType* B, int32 Length)
+	{
+		typedef typename TCharUnit<sizeof(CharType)>::Type FUnit;
+
+		int32 i = 0;
+
+		if constexpr (VecType::Size > 0)
+		{
+			constexpr int32 unitsPerVector = VecType::Size / sizeof(FUnit);
+
+			for (; i + unitsPerVector <= Length; i += unitsPerVector)
+			{
+				const typename VecType::FVector a = FoldAscii<VecType, FUnit>(VecType::Load(A + i));
+				const typename VecType::FVector b = FoldAscii<VecType, FUnit>(VecType::Load(B + i));
+
+				if (VecType::Mask(VecType::template Equal<FUnit>(a, b)) == VecType::FullMask)
+					continue;
+
+				if (sizeof(FUnit) == 1 || !EqualsFolded(A, B, i, i + unitsPerVector))
+					return false;
+			}
+		}
+
+		return EqualsFolded(A, B, i, Length);
+	}
+}
+
+template<typename CharType>
+int32 FStringSearch::FindChar(const CharType* Data, int32 Length, CharType Char)
+{
+	typedef typename TCharUnit<sizeof(CharType)>::Type FUnit;
+
+	return Dispatch([&]<typename VecType>()
+	{
+		return ScanForward<VecType>(ToUnits(Data), Length, TCharMatcher<VecType, FUnit>(static_cast<FUnit>(Char)));
+	});
+}
+
+template<typename CharType>
+int32 FStringSearch::FindLastChar(const CharType* Data, int32 Length, CharType Char)
+{
+	typedef typename TCharUnit<sizeof(CharType)>::Type FUnit;
+
+	return Dispatch([&]<typename VecType>()
+	{
+		return ScanBackward<VecType>(ToUnits(Data), Length, TCharMatcher<VecType, FUnit>(static_cast<FUnit>(Char)));
+	});
+}
+
+template<typename CharType>
+int32 FStringSearch::Find(const CharType* Data, int32 Length, const CharType* SubStr, int32 SubStrLength)
+{
+	if (SubStrLength <= 0 || SubStrLength > Length)
+		return INDEX_NONE;
+	if (SubStrLength == 1)
+		return FindChar(Data, Length, SubStr[0]);
+
+	return Dispatch([&]<typename VecType>()
+	{
+		return FindSubstring<VecType>(ToUnits(Data), Length, ToUnits(SubStr), SubStrLength);
+	});
+}
+
+template<typename CharType>
+int32 FStringSearch::FindLast(const CharType* Data, int32 Length, const CharType* SubStr, int32 SubStrLength)
+{
+	if (SubStrLength <= 0 || SubStrLength > Length)
+		return INDEX_NONE;
+	if (SubStrLength == 1)
+		return FindLastChar(Data, Length, SubStr[0]);
+
+	return Dispatch([&]<typename VecType>()
+	{
+		return FindLastSubstring<VecType>(ToUnits(Data), Length, ToUnits(SubStr), SubStrLength);
+	});
+}
+
+template<typename CharType>
+int32 FStringSearch::FindFirstOf(const CharType* Data, int32 Length, const CharType* Chars, int32 NumChars)
+{
+	if (NumChars <= 0)
+		return INDEX_NONE;
+	if (NumChars > IE_STRING_SEARCH_MAX_VECTOR_SET)
+		return ScanForward<FScalar>(ToUnits(Data), Length, TSetMatcher<FScalar, typename TCharUnit<sizeof(CharType)>::Type, false>(ToUnits(Chars), NumChars));
+
+	return Dispatch([&]<typename VecType>()
+	{
+		return ScanForward<VecType>(ToUnits(Data), Length, TSetMatcher<VecType, typename TCharUnit<sizeof(CharType)>::Type, false>(ToUnits(Chars), NumChars));
+	});
+}
+
+template<typename CharType>
+int32 FStringSearch::FindLastOf(const CharType* Data, int32 Length, const CharType* Chars, int32 NumChars)
+{
+	if (NumChars <= 0)
+		return INDEX_NONE;
+	if (NumChars > IE_STRING_SEARCH_MAX_VECTOR_SET)
+		return ScanBackward<FScalar>(ToUnits(Data), Length, TSetMatcher<FScalar, typename TCharUnit<sizeof(CharType)>::Type, false>(ToUnits(Chars), NumChars));
+
+	return Dispatch([&]<typename VecType>()
+	{
+		return ScanBackward<VecType>(ToUnits(Data), Length, TSetMatcher<VecType, typename TCharUnit<sizeof(CharType)>::Type, false>(ToUnits(Chars), NumChars));
+	});
+}
+
+template<typename CharType>
+int32 FStringSearch::FindFirstNotOf(const CharType* Data, int32 Length, const CharType* Chars, int32 NumChars)
+{
+	if (NumChars <= 0)
+		return Length > 0 ? 0 : INDEX_NONE;
+	if (NumChars > IE_STRING_SEARCH_MAX_VECTOR_SET)
+		return ScanForward<FScalar>(ToUnits(Data), Length, TSetMatcher<FScalar, typename TCharUnit<sizeof(CharType)>::Type, true>(ToUnits(Chars), NumChars));
+
+	return Dispatch([&]<typename VecType>()
+	{
+		return ScanForward<VecType>(ToUnits(Data), Length, TSetMatcher<VecType, typename TCharUnit<sizeof(CharType)>::Type, true>(ToUnits(Chars), NumChars));
+	});
+}
+
+template<typename CharType>
+int32 FStringSearch::FindLastNotOf(const CharType* Data, int32 Length, const CharType* Chars, int32 NumChars)
+{
+	if (NumChars <= 0)
+		return Length > 0 ? Length - 1 : INDEX_NONE;
+	if (NumChars > IE_STRING_SEARCH_MAX_VECTOR_SET)
+		return ScanBackward<FScalar>(ToUnits(Data), Length, TSetMatcher<FScalar, typename TCharUnit<sizeof(CharType)>::Type, true>(ToUnits(Chars), NumChars));
+
+	return Dispatch([&]<typename VecType>()
+	{
+		return ScanBackward<VecType>(ToUnits(Data), Length, TSetMatcher<VecType, typename TCharUnit<sizeof(CharType)>::Type, true>(ToUnits(Chars), NumChars));
+	});
+}
+
+template<typename CharType>
+bool FStringSearch::EqualsIgnoreCase(const CharType* A, const CharType* B, int32 Length)
+{
+	return Dispatch([&]<typename VecType>()
+	{
+		return EqualsIgnoreCaseKernel<VecType>(A, B, Length) ? 1 : 0;
+	}) != 0;
+}
+
+template<typename CharType>
+bool FStringSearch::EqualsIgnoreCaseAscii(const CharType* A, const CharType* B, int32 Length)
+{
+	return Dispatch([&]<typename VecType>()
+	{
+		return EqualsIgnoreCaseAsciiKernel<VecType>(A, B, Length) ? 1 : 0;
+	}) != 0;
+}
+
+template<typename CharType>
+void FStringSearch::ToUpperAscii(const CharType* Source, CharType* Dest, int32 Length)
+{
+	Dispatch([&]<typename VecType>()
+	{
+		ToUpperAsciiKernel<VecType>(Source, Dest, Length);
+		return 0;
+	});
+}
+
+template<typename CharType>
+int32 FStringSearch::Strlen(const CharType* String)
+{
+	return Dispatch([&]<typename VecType>()
+	{
+		return FindTerminator<VecType>(ToUnits(String));
+	});
+}
+
+#define IE_STRING_SEARCH_INSTANTIATE(CharType) \
+	template int32 FStringSearch::FindChar<CharType>(const CharType*, int32, CharType); \
+	template int32 FStringSearch::FindLastChar<CharType>(const CharType*, int32, CharType); \
+	template int32 FStringSearch::Find<CharType>(const CharType*, int32, const CharType*, int32); \
+	template int32 FStringSearch::FindLast<CharType>(const CharType*, int32, const CharType*, int32); \
+	template int32 FStringSearch::FindFirstOf<CharType>(const CharType*, int32, const CharType*, int32); \
+	template int32 FStringSearch::FindLastOf<CharType>(const CharType*, int32, const CharType*, int32); \
+	template int32 FStringSearch::FindFirstNotOf<CharType>(const CharType*, int32, const CharType*, int32); \
+	template int32 FStringSearch::FindLastNotOf<CharType>(const CharType*, int32, const CharType*, int32); \
+	template int32 FStringSearch::Strlen<CharType>(const CharType*); \
+	template bool FStringSearch::EqualsIgnoreCase<CharType>(const CharType*, const CharType*, int32); \
+	template bool FStringSearch::EqualsIgnoreCaseAscii<CharType>(const CharType*, const CharType*, int32); \
+	template void FStringSearch::ToUpperAscii<CharType>(const CharType*, CharType*, int32);
+
+IE_STRING_SEARCH_INSTANTIATE(ANSICHAR)
+IE_STRING_SEARCH_INSTANTIATE(WIDECHAR)
+IE_STRING_SEARCH_INSTANTIATE(CHAR8)
+IE_STRING_SEARCH_INSTANTIATE(CHAR16)
+IE_STRING_SEARCH_INSTANTIATE(CHAR32)
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "Misc/Tokenizer.h"
+
+#include "Misc/StringSearch.h"
+
+FTokenizer::FTokenizer(FStringView InSource, bool bInAllowEmptyTokens, bool bInKeepQuotes, TCHAR InDelim, TCHAR InQuote, TCHAR InEscape)
+	: m_Source(InSource)
+	, m_Delim(InDelim)
+	, m_Quote(InQuote)
+	, m_Escape(InEscape)
+	, m_bAllowEmptyTokens(bInAllowEmptyTokens)
+	, m_bKeepQuotes(bInKeepQuotes)
+{
+	// An empty source has no tokens, not even an empty one
+	if (m_Source.IsEmpty())
+		m_Position = 1;
+}
+
+bool FTokenizer::Next()
+{
+	const TCHAR* data = m_Source.GetData();
+	const int32 length = m_Source.Length();
+	const TCHAR specialChars[] = { m_Delim, m_Quote };
+
+	while (m_Position <= length)
+	{
+		const int32 start = m_Position;
+
+		// Find the delimiter that ends the token, runs of ordinary characters are skipped with a vectorized scan
+
+		int32 index = start;
+		int32 numQuotes = 0;
+		bool bHasEscapes = false;
+		bool bInQuotes = false;
+
+		while (index < length)
+		{
+			// Inside quotes only the closing quote ends the run
+			const int32 runLength = bInQuotes
+				? FStringSearch::FindChar(data + index, length - index, m_Quote)
+				: FStringSearch::FindFirstOf(data + index, length - index, specialChars, 2);
+
+			if (runLength == INDEX_NONE)
+			{
+				index = length;
+				break;
+			}
+
+			index += runLength;
+
+			if (data[index] == m_Quote)
+			{
+				// Inside quotes an odd run of escape characters escapes the quote, an even run is escaped escape characters.
+				// The run stops at the opening quote at the latest.
+				const int32 numEscapes = bInQuotes ? CountEscapes(data + start, index - start) : 0;
+				bHasEscapes |= numEscapes > 0;
+
+				if (numEscapes % 2 == 0)
+				{
+					bInQuotes = !bInQuotes;
+					numQuotes++;
+				}
+
+				index++;
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		m_Position = index + 1;
+
+		const FStringView token(data + start, index - start);
+
+		if (numQuotes == 0 && !bHasEscapes)
+			m_Token = token;
+		else if (m_bKeepQuotes && !bHasEscapes)
+			m_Token = token;
+		else if (!bHasEscapes && numQuotes == 2 && token[0] == m_Quote && token[token.Length() - 1] == m_Quote)
+			m_Token = token.Mid(1, token.Length() - 2); // Quotes around the whole token, common for paths
+		else
+			m_Token = Unquote(token);
+
+		if (!m_Token.IsEmpty() || m_bAllowEmptyTokens)
+			return true;
+	}
+
+	m_Token = FStringView();
+	return false;
+}
+
+FStringView FTokenizer::Unquote(FStringView InToken)
+{
+	m_Buffer.Reset();
+
+	bool bInQuotes = false;
+	for (int32 i = 0; i < InToken.Length(); ++i)
+	{
+		const TCHAR character = InToken[i];
+
+		if (bInQuotes && m_Escape && character == m_Escape)
+		{
+			// A run of escape characters followed by a quote keeps half of them, an odd one escapes the quote.
+			// Escape characters that aren't followed by a quote are kept as they are.
+
+			int32 runEnd = i;
+			while (runEnd < InToken.Length() && InToken[runEnd] == m_Escape)
+				++runEnd;
+
+			const int32 numEscapes = runEnd - i;
+			const bool bBeforeQuote = runEnd < InToken.Length() && InToken[runEnd] == m_Quote;
+
+			for (int32 j = 0; j < (bBeforeQuote ? numEscapes / 2 : numEscapes); ++j)
+				m_Buffer.AppendChar(m_Escape);
+
+			if (bBeforeQuote && numEscapes % 2 != 0)
+			{
+				m_Buffer.AppendChar(m_Quote);
+				++runEnd;
+			}
+
+			// The closing quote after an even run is handled by the next iteration
+			i = runEnd - 1;
+		}
+		else if (character == m_Quote)
+		{
+			if (m_bKeepQuotes)
+				m_Buffer.AppendChar(character);
+
+			bInQuotes = !bInQuotes;
+		}
+		else
+		{
+			m_Buffer.AppendChar(character);
+		}
+	}
+
+	return m_Buffer.ToView();
+}
+
+int32 FTokenizer::CountEscapes(const TCHAR* InData, int32 InLength) const
+{
+	if (!m_Escape)
+		return 0;
+
+	int32 numEscapes = 0;
+	while (numEscapes < InLength && InData[InLength - 1 - numEscapes] == m_Escape)
+		++numEscapes;
+
+	return numEscapes;
+}
\ No newline at end of file
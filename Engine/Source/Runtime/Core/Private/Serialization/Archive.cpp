@@ -1,24 +1,64 @@
 #include "Serialization/Archive.h"
 
+#include "Math/Math.h"
+
 void FMemoryArchive::Serialize(void* Data, uint64 Num)
 {
 	if (bIsLoading)
 	{
-		if (Pos + Num > TotalSize())
+		// Written so that a huge Num from corrupt data can't overflow, the position may be past the end after a seek
+		if (Pos > TotalSize() || Num > TotalSize() - Pos)
 		{
 			bIsError = true;
 			return;
 		}
 
-		FMemory::Memcpy(Data, &DataRef[static_cast<int32>(Pos)], Num);
+		const uint8* source = DataArray ? DataArray->GetData() : View;
+		FMemory::Memcpy(Data, source + Pos, Num);
 	}
 	else
 	{
-		DataRef.SetNumUninitialized(static_cast<int32>(Pos + Num));
-		FMemory::Memcpy(&DataRef[static_cast<int32>(Pos)], Data, Num);
+		checkf(Pos <= static_cast<uint64>(MAX_int32) && Num <= static_cast<uint64>(MAX_int32) - Pos, TEXT("Memory archives are limited to 2 GiB."));
+		const uint64 end = Pos + Num;
+
+		// Writing before the end after a seek overwrites the data in place, the array never shrinks
+
+		const int32 oldNum = DataArray->Num();
+		if (end > static_cast<uint64>(oldNum))
+		{
+			// Grow geometrically, so serializing many small values doesn't reallocate the array for every value
+			const int64 capacity = DataArray->Capacity();
+			if (static_cast<int64>(end) > capacity)
+				DataArray->Reserve(static_cast<int32>(FMath::Min(FMath::Max(static_cast<int64>(end), capacity * 2), static_cast<int64>(MAX_int32)) - capacity));
+
+			DataArray->AddUninitialized(static_cast<int32>(end) - oldNum);
+
+			// Seeking past the end leaves a gap, zero it instead of writing uninitialized memory
+			if (Pos > static_cast<uint64>(oldNum))
+				FMemory::Memzero(DataArray->GetData() + oldNum, Pos - oldNum);
+		}
+
+		FMemory::Memcpy(DataArray->GetData() + Pos, Data, Num);
+	}
+
+	Pos += Num;
+}
+
+const uint8* FMemoryArchive::SerializeView(uint64 Num)
+{
+	if (!bIsLoading || bIsError)
+		return nullptr;
+
+	if (Pos > TotalSize() || Num > TotalSize() - Pos)
+	{
+		bIsError = true;
+		return nullptr;
 	}
 
+	const uint8* data = (DataArray ? DataArray->GetData() : View) + Pos;
 	Pos += Num;
+
+	return data;
 }
 
 void FMemoryArchive::Seek(uint64 InPos)
@@ -33,7 +73,7 @@ uint64 FMemoryArchive::Tell()
 
 uint64 FMemoryArchive::TotalSize()
 {
-	return static_cast<uint64>(DataRef.Num());
+	return DataArray ? static_cast<uint64>(DataArray->Num()) : ViewSize;
 }
 
 bool FMemoryArchive::IsLoading()
@@ -51,6 +91,11 @@ bool FMemoryArchive::IsError()
 	return bIsError;
 }
 
+void FMemoryArchive::SetError()
+{
+	bIsError = true;
+}
+
 bool FMemoryArchive::AtEnd()
 {
 	return Pos >= TotalSize();
@@ -64,6 +109,96 @@ void FMemoryArchive::Close()
 {
 }
 
+void FArchive::SerializeCompressedInt(uint64& Value)
+{
+	if (IsLoading())
+	{
+		Value = 0;
+
+		// A 64 bit value takes at most 10 bytes
+		for (uint32 shift = 0; shift < 64; shift += 7)
+		{
+			uint8 byte = 0;
+			Serialize(&byte, 1);
+
+			if (IsError())
+				break;
+
+			Value |= static_cast<uint64>(byte & 0x7F) << shift;
+
+			if ((byte & 0x80) == 0)
+				return;
+		}
+
+		Value = 0;
+		SetError();
+	}
+	else
+	{
+		uint8 bytes[10];
+		uint64 numBytes = 0;
+
+		uint64 value = Value;
+		do
+		{
+			bytes[numBytes] = static_cast<uint8>(value & 0x7F);
+			value >>= 7;
+
+			if (value != 0)
+				bytes[numBytes] |= 0x80;
+
+			++numBytes;
+		}
+		while (value != 0);
+
+		Serialize(bytes, numBytes);
+	}
+}
+
+void FArchive::SerializeCompressedInt(uint32& Value)
+{
+	uint64 value = Value;
+	SerializeCompressedInt(value);
+
+	if (IsLoading())
+	{
+		if (value > MAX_uint32)
+		{
+			value = 0;
+			SetError();
+		}
+
+		Value = static_cast<uint32>(value);
+	}
+}
+
+void FArchive::SerializeCompressedInt(int64& Value)
+{
+	// Zig-zag maps 0, -1, 1, -2, ... to 0, 1, 2, 3, ...
+	uint64 value = (static_cast<uint64>(Value) << 1) ^ static_cast<uint64>(Value >> 63);
+	SerializeCompressedInt(value);
+
+	if (IsLoading())
+		Value = static_cast<int64>(value >> 1) ^ -static_cast<int64>(value & 1);
+}
+
+void FArchive::SerializeCompressedInt(int32& Value)
+{
+	int64 value = Value;
+	SerializeCompressedInt(value);
+
+	if (IsLoading())
+	{
+		if (value < MIN_int32 || value > MAX_int32)
+		{
+			value = 0;
+			SetError();
+		}
+
+		Value = static_cast<int32>(value);
+	}
+}
+
 FArchive& operator<<(FArchive& Ar, bool& Value)
 {
 	Ar.Serialize(&Value, sizeof(bool));
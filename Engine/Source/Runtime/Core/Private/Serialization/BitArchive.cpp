@@ -0,0 +1,223 @@
+#include "Serialization/BitArchive.h"
+
+#include "Math/Math.h"
+
+namespace
+{
+	/**
+	* Copies bits between buffers at arbitrary bit offsets, in chunks of up to 8 bits.
+	* The destination bits are overwritten, bits around them are kept.
+	*/
+	void CopyBits(uint8* Dst, uint64 DstBit, const uint8* Src, uint64 SrcBit, uint64 NumBits)
+	{
+		// Both byte aligned, copy whole bytes
+
+		if ((DstBit & 7) == 0 && (SrcBit & 7) == 0)
+		{
+			const uint64 numBytes = NumBits >> 3;
+			FMemory::Memcpy(Dst + (DstBit >> 3), Src + (SrcBit >> 3), numBytes);
+
+			DstBit += numBytes << 3;
+			SrcBit += numBytes << 3;
+			NumBits -= numBytes << 3;
+		}
+
+		while (NumBits > 0)
+		{
+			const uint32 dstShift = static_cast<uint32>(DstBit & 7);
+			const uint32 srcShift = static_cast<uint32>(SrcBit & 7);
+			const uint32 numChunkBits = static_cast<uint32>(FMath::Min<uint64>(NumBits, 8 - FMath::Max(dstShift, srcShift)));
+
+			const uint8 mask = static_cast<uint8>((1u << numChunkBits) - 1);
+			const uint8 bits = (Src[SrcBit >> 3] >> srcShift) & mask;
+
+			uint8& dst = Dst[DstBit >> 3];
+			dst = static_cast<uint8>((dst & ~(mask << dstShift)) | (bits << dstShift));
+
+			DstBit += numChunkBits;
+			SrcBit += numChunkBits;
+			NumBits -= numChunkBits;
+		}
+	}
+}
+
+void FBitArchive::SerializeBit(bool& bValue)
+{
+	uint8 value = bValue ? 1 : 0;
+	SerializeBits(&value, 1);
+
+	bValue = value != 0;
+}
+
+void FBitArchive::SerializeInt(uint32& Value, uint32 ValueMax)
+{
+	checkf(ValueMax > 0, TEXT("Invalid maximum value."));
+
+	// Number of bits needed for ValueMax - 1
+	uint32 numBits = 0;
+	while (numBits < 32 && (static_cast<uint64>(1) << numBits) < ValueMax)
+		++numBits;
+
+	uint32 value = IsSaving() ? FMath::Min(Value, ValueMax - 1) : 0;
+	SerializeBits(&value, numBits);
+
+	if (IsLoading())
+	{
+		if (value >= ValueMax)
+		{
+			value = 0;
+			SetError();
+		}
+
+		Value = value;
+	}
+}
+
+void FBitArchive::SerializeQuantizedFloat(float& Value, float Min, float Max, uint32 NumBits)
+{
+	checkf(NumBits > 0 && NumBits <= 32 && Min < Max, TEXT("Invalid quantization."));
+
+	const double maxQuantized = static_cast<double>((static_cast<uint64>(1) << NumBits) - 1);
+
+	uint32 quantized = 0;
+	if (IsSaving())
+	{
+		const double alpha = (static_cast<double>(FMath::Clamp(Value, Min, Max)) - Min) / (static_cast<double>(Max) - Min);
+		quantized = static_cast<uint32>(FMath::Round(alpha * maxQuantized));
+	}
+
+	SerializeBits(&quantized, NumBits);
+
+	if (IsLoading())
+		Value = static_cast<float>(Min + (static_cast<double>(Max) - Min) * (quantized / maxQuantized));
+}
+
+void FBitArchive::Serialize(void* Data, uint64 Num)
+{
+	// A huge Num from corrupt data would overflow the number of bits
+	if (Num > MAX_uint64 / 8)
+	{
+		SetError();
+		return;
+	}
+
+	SerializeBits(Data, Num * 8);
+}
+
+void FBitArchive::Seek(uint64 InPos)
+{
+	PosBits = InPos * 8;
+}
+
+uint64 FBitArchive::Tell()
+{
+	return (PosBits + 7) / 8;
+}
+
+bool FBitArchive::IsError()
+{
+	return bIsError;
+}
+
+void FBitArchive::SetError()
+{
+	bIsError = true;
+}
+
+void FBitArchive::Flush()
+{
+}
+
+void FBitArchive::Close()
+{
+}
+
+void FBitWriter::SerializeBits(void* Data, uint64 InNumBits)
+{
+	if (bIsError || InNumBits == 0)
+		return;
+
+	const uint64 endBits = PosBits + InNumBits;
+	const uint64 numBytes = (endBits + 7) / 8;
+
+	if (numBytes > static_cast<uint64>(MAX_int32))
+	{
+		bIsError = true;
+		return;
+	}
+
+	const int32 oldNumBytes = Buffer.Num();
+	if (numBytes > static_cast<uint64>(oldNumBytes))
+	{
+		// Grow geometrically, bit writers are mostly used for many small values
+		const int64 capacity = Buffer.Capacity();
+		if (static_cast<int64>(numBytes) > capacity)
+			Buffer.Reserve(static_cast<int32>(FMath::Min(FMath::Max(static_cast<int64>(numBytes), capacity * 2), static_cast<int64>(MAX_int32)) - capacity));
+
+		Buffer.AddUninitialized(static_cast<int32>(numBytes) - oldNumBytes);
+		FMemory::Memzero(Buffer.GetData() + oldNumBytes, numBytes - oldNumBytes);
+	}
+
+	CopyBits(Buffer.GetData(), PosBits, static_cast<const uint8*>(Data), 0, InNumBits);
+
+	PosBits = endBits;
+	NumBits = FMath::Max(NumBits, endBits);
+}
+
+uint64 FBitWriter::TotalSize()
+{
+	return (NumBits + 7) / 8;
+}
+
+bool FBitWriter::IsLoading()
+{
+	return false;
+}
+
+bool FBitWriter::IsSaving()
+{
+	return true;
+}
+
+bool FBitWriter::AtEnd()
+{
+	return PosBits >= NumBits;
+}
+
+void FBitReader::SerializeBits(void* OutData, uint64 InNumBits)
+{
+	// Partially filled bytes are returned with the remaining bits zeroed
+	FMemory::Memzero(OutData, (InNumBits + 7) / 8);
+
+	if (bIsError || InNumBits == 0)
+		return;
+
+	if (InNumBits > GetBitsLeft())
+	{
+		bIsError = true;
+		return;
+	}
+
+	CopyBits(static_cast<uint8*>(OutData), 0, Data, PosBits, InNumBits);
+	PosBits += InNumBits;
+}
+
+uint64 FBitReader::TotalSize()
+{
+	return (NumBits + 7) / 8;
+}
+
+bool FBitReader::IsLoading()
+{
+	return true;
+}
+
+bool FBitReader::IsSaving()
+{
+	return false;
+}
+
+bool FBitReader::AtEnd()
+{
+	return PosBits >= NumBits;
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "Serialization/ChecksumArchive.h"
+
+#include "Math/Math.h"
+
+#include "Misc/Crc.h"
+
+void FChecksumArchive::Serialize(void* Data, uint64 Num)
+{
+	Inner.Serialize(Data, Num);
+
+	// Loaded data is only valid if the inner archive succeeded
+	if (!Inner.IsError())
+		Checksum = FCrc::Crc32C(Data, Num, Checksum);
+}
+
+void FChecksumArchive::SerializeBulk(void* Data, uint64 ElementSize, uint64 Num)
+{
+	Inner.SerializeBulk(Data, ElementSize, Num);
+
+	if (!Inner.IsError())
+		Checksum = FCrc::Crc32C(Data, ElementSize * Num, Checksum);
+}
+
+const uint8* FChecksumArchive::SerializeView(uint64 Num)
+{
+	const uint8* data = Inner.SerializeView(Num);
+
+	if (data)
+		Checksum = FCrc::Crc32C(data, Num, Checksum);
+
+	return data;
+}
+
+void FChecksumArchive::Seek(uint64 InPos)
+{
+	uint64 pos = Inner.Tell();
+	if (InPos == pos)
+		return;
+
+	// Seeking back would checksum bytes twice, or after they were overwritten while saving
+	checkf(IsLoading() && InPos > pos, TEXT("A checksum archive can only seek forward while loading."));
+
+	// Skipped bytes are read, so the checksum covers them like it did while saving
+
+	if (SerializeView(InPos - pos))
+		return;
+
+	uint8 buffer[4096];
+
+	while (pos < InPos && !Inner.IsError())
+	{
+		const uint64 num = FMath::Min<uint64>(InPos - pos, sizeof(buffer));
+		Serialize(buffer, num);
+
+		pos += num;
+	}
+}
+
+uint64 FChecksumArchive::Tell()
+{
+	return Inner.Tell();
+}
+
+uint64 FChecksumArchive::TotalSize()
+{
+	return Inner.TotalSize();
+}
+
+bool FChecksumArchive::IsLoading()
+{
+	return Inner.IsLoading();
+}
+
+bool FChecksumArchive::IsSaving()
+{
+	return Inner.IsSaving();
+}
+
+bool FChecksumArchive::IsError()
+{
+	return Inner.IsError();
+}
+
+void FChecksumArchive::SetError()
+{
+	Inner.SetError();
+}
+
+bool FChecksumArchive::AtEnd()
+{
+	return Inner.AtEnd();
+}
+
+void FChecksumArchive::Flush()
+{
+	Inner.Flush();
+}
+
+void FChecksumArchive::Close()
+{
+	Inner.Close();
+}
\ No newline at end of file
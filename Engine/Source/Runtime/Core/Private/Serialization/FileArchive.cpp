@@ -0,0 +1,356 @@
+#include "Serialization/FileArchive.h"
+
+#include "Math/Math.h"
+
+FArchiveFileReader::FArchiveFileReader(const FString& Filename, uint32 InBufferSize, bool bInAsyncPrefetch)
+	: bAsyncPrefetch(bInAsyncPrefetch)
+{
+	checkf(InBufferSize > 0 && InBufferSize <= static_cast<uint32>(MAX_int32), TEXT("Invalid buffer size."));
+
+	Handle = FFilesystem::OpenFile(Filename, FILE_Read);
+	if (!FFilesystem::IsFileValid(Handle))
+	{
+		Handle = nullptr;
+		bIsError = true;
+
+		return;
+	}
+
+	FileSize = FFilesystem::GetFileSize(Handle);
+
+	// No need for a buffer larger than the file
+	Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min(static_cast<uint64>(InBufferSize), FMath::Max(FileSize, static_cast<uint64>(1)))));
+
+	if (bAsyncPrefetch)
+		PrefetchBuffer.SetNumUninitialized(Buffer.Num());
+}
+
+FArchiveFileReader::~FArchiveFileReader()
+{
+	Close();
+}
+
+void FArchiveFileReader::Serialize(void* Data, uint64 Num)
+{
+	if (bIsError)
+		return;
+
+	if (Pos > FileSize || Num > FileSize - Pos)
+	{
+		bIsError = true;
+		return;
+	}
+
+	uint8* dst = static_cast<uint8*>(Data);
+	const uint64 bufferSize = static_cast<uint64>(Buffer.Num());
+
+	while (Num > 0)
+	{
+		// Copy what the buffer has of the requested range
+
+		if (Pos >= BufferStart && Pos < BufferStart + BufferNum)
+		{
+			const uint64 bytesToCopy = FMath::Min(Num, BufferStart + BufferNum - Pos);
+			FMemory::Memcpy(dst, Buffer.GetData() + (Pos - BufferStart), bytesToCopy);
+
+			dst += bytesToCopy;
+			Pos += bytesToCopy;
+			Num -= bytesToCopy;
+
+			continue;
+		}
+
+		// Large reads bypass the buffer
+
+		if (Num >= bufferSize)
+		{
+			FReadFileOptions options;
+			options.Offset = Pos;
+
+			if (!FFilesystem::ReadData(Handle, dst, Num, options))
+			{
+				bIsError = true;
+				return;
+			}
+
+			Pos += Num;
+			return;
+		}
+
+		if (!FillBuffer())
+		{
+			bIsError = true;
+			return;
+		}
+	}
+}
+
+void FArchiveFileReader::Seek(uint64 InPos)
+{
+	// The buffer stays valid, seeking back into it doesn't read the file again
+	Pos = InPos;
+}
+
+uint64 FArchiveFileReader::Tell()
+{
+	return Pos;
+}
+
+uint64 FArchiveFileReader::TotalSize()
+{
+	return FileSize;
+}
+
+bool FArchiveFileReader::IsLoading()
+{
+	return true;
+}
+
+bool FArchiveFileReader::IsSaving()
+{
+	return false;
+}
+
+bool FArchiveFileReader::IsError()
+{
+	return bIsError;
+}
+
+void FArchiveFileReader::SetError()
+{
+	bIsError = true;
+}
+
+bool FArchiveFileReader::AtEnd()
+{
+	return Pos >= FileSize;
+}
+
+void FArchiveFileReader::Flush()
+{
+}
+
+void FArchiveFileReader::Close()
+{
+	CancelPrefetch();
+
+	if (Handle)
+	{
+		FFilesystem::CloseFile(Handle);
+		Handle = nullptr;
+	}
+}
+
+bool FArchiveFileReader::FillBuffer()
+{
+	const uint64 bytesToRead = FMath::Min(static_cast<uint64>(Buffer.Num()), FileSize - Pos);
+
+	if (PrefetchRequest && PrefetchStart == Pos)
+	{
+		// Sequential read, the prefetch has the data
+
+		PrefetchRequest->WaitForCompletion();
+		const bool bSuccess = PrefetchRequest->Succeeded();
+		PrefetchRequest = FAsyncReadRequestPtr();
+
+		if (bSuccess)
+		{
+			Swap(Buffer, PrefetchBuffer);
+			BufferStart = Pos;
+			BufferNum = bytesToRead;
+
+			StartPrefetch();
+			return true;
+		}
+	}
+
+	CancelPrefetch();
+
+	FReadFileOptions options;
+	options.Offset = Pos;
+
+	if (!FFilesystem::ReadData(Handle, Buffer.GetData(), bytesToRead, options))
+	{
+		BufferNum = 0;
+		return false;
+	}
+
+	BufferStart = Pos;
+	BufferNum = bytesToRead;
+
+	StartPrefetch();
+	return true;
+}
+
+void FArchiveFileReader::StartPrefetch()
+{
+	PrefetchStart = BufferStart + BufferNum;
+
+	if (!bAsyncPrefetch || PrefetchStart >= FileSize)
+		return;
+
+	const uint64 bytesToRead = FMath::Min(static_cast<uint64>(PrefetchBuffer.Num()), FileSize - PrefetchStart);
+	PrefetchRequest = FAsyncFileIO::Get().Read(Handle, PrefetchStart, bytesToRead, PrefetchBuffer.GetData());
+}
+
+void FArchiveFileReader::CancelPrefetch()
+{
+	if (!PrefetchRequest)
+		return;
+
+	// A request that is already in flight still writes to the prefetch buffer
+	if (!PrefetchRequest->Cancel())
+		PrefetchRequest->WaitForCompletion();
+
+	PrefetchRequest = FAsyncReadRequestPtr();
+}
+
+FArchiveFileWriter::FArchiveFileWriter(const FString& Filename, uint32 InBufferSize)
+{
+	checkf(InBufferSize > 0 && InBufferSize <= static_cast<uint32>(MAX_int32), TEXT("Invalid buffer size."));
+
+	if (!FFilesystem::IsFile(Filename) && !FFileHelper::CreateFilePath(Filename))
+	{
+		bIsError = true;
+		return;
+	}
+
+	Handle = FFilesystem::OpenFile(Filename, static_cast<EFileAccess>(FILE_Write | FILE_Truncate));
+	if (!FFilesystem::IsFileValid(Handle))
+	{
+		Handle = nullptr;
+		bIsError = true;
+
+		return;
+	}
+
+	Buffer.SetNumUninitialized(static_cast<int32>(InBufferSize));
+}
+
+FArchiveFileWriter::~FArchiveFileWriter()
+{
+	Close();
+}
+
+void FArchiveFileWriter::Serialize(void* Data, uint64 Num)
+{
+	if (bIsError || Num == 0)
+		return;
+
+	// The buffer holds one contiguous range, writes elsewhere after a seek start a new one
+
+	const uint64 bufferSize = static_cast<uint64>(Buffer.Num());
+
+	if (Pos != BufferStart + BufferNum || BufferNum + Num > bufferSize)
+	{
+		if (!FlushBuffer())
+			return;
+
+		BufferStart = Pos;
+	}
+
+	if (Num >= bufferSize)
+	{
+		// Large writes bypass the buffer
+
+		if (WriteToFile(Data, Num, Pos))
+		{
+			Pos += Num;
+			BufferStart = Pos;
+		}
+
+		return;
+	}
+
+	FMemory::Memcpy(Buffer.GetData() + BufferNum, Data, Num);
+
+	BufferNum += Num;
+	Pos += Num;
+}
+
+void FArchiveFileWriter::Seek(uint64 InPos)
+{
+	Pos = InPos;
+}
+
+uint64 FArchiveFileWriter::Tell()
+{
+	return Pos;
+}
+
+uint64 FArchiveFileWriter::TotalSize()
+{
+	return FMath::Max(FileSize, BufferStart + BufferNum);
+}
+
+bool FArchiveFileWriter::IsLoading()
+{
+	return false;
+}
+
+bool FArchiveFileWriter::IsSaving()
+{
+	return true;
+}
+
+bool FArchiveFileWriter::IsError()
+{
+	return bIsError;
+}
+
+void FArchiveFileWriter::SetError()
+{
+	bIsError = true;
+}
+
+bool FArchiveFileWriter::AtEnd()
+{
+	return Pos >= TotalSize();
+}
+
+void FArchiveFileWriter::Flush()
+{
+	FlushBuffer();
+}
+
+void FArchiveFileWriter::Close()
+{
+	if (!Handle)
+		return;
+
+	FlushBuffer();
+
+	FFilesystem::CloseFile(Handle);
+	Handle = nullptr;
+}
+
+bool FArchiveFileWriter::FlushBuffer()
+{
+	if (bIsError)
+		return false;
+
+	if (BufferNum == 0)
+		return true;
+
+	const bool bSuccess = WriteToFile(Buffer.GetData(), BufferNum, BufferStart);
+
+	BufferNum = 0;
+	BufferStart = Pos;
+
+	return bSuccess;
+}
+
+bool FArchiveFileWriter::WriteToFile(const void* Data, uint64 Num, uint64 Offset)
+{
+	FGenericWriteFileOptions options;
+	options.Offset = Offset;
+
+	if (!FFilesystem::WriteData(Handle, Data, Num, options))
+	{
+		bIsError = true;
+		return false;
+	}
+
+	FileSize = FMath::Max(FileSize, Offset + Num);
+	return true;
+}
\ No newline at end of file
@@ -1 +1,44 @@
-#include "Serialization/Serializer.h"
\ No newline at end of file
+#include "Serialization/Serializer.h"
+
+void FSerializer::SaveFieldData(FArchive& Ar, uint32 Id, const uint8* Data, uint64 Size)
+{
+	Ar.SerializeCompressedInt(Id);
+
+	checkf(Size <= MAX_uint32, TEXT("Serialized field is larger than 4 GiB."));
+
+	uint32 size = static_cast<uint32>(Size);
+	Ar.SerializeCompressedInt(size);
+
+	if (size > 0)
+		Ar.Serialize(const_cast<uint8*>(Data), size);
+}
+
+bool FSerializer::ReadFieldHeader(FArchive& Ar, uint32& OutId, uint64& OutFieldEnd)
+{
+	Ar.SerializeCompressedInt(OutId);
+
+	if (Ar.IsError() || OutId == 0)
+		return false;
+
+	uint32 size = 0;
+	Ar.SerializeCompressedInt(size);
+
+	const uint64 fieldStart = Ar.Tell();
+	if (Ar.IsError() || size > Ar.TotalSize() - FMath::Min(fieldStart, Ar.TotalSize()))
+	{
+		Ar.SetError();
+		return false;
+	}
+
+	OutFieldEnd = fieldStart + size;
+	return true;
+}
+
+void FSerializer::EndLoadField(FArchive& Ar, uint64 FieldEnd)
+{
+	// A field that read past its size is malformed, one that read less was saved by a newer version
+	if (Ar.Tell() > FieldEnd)
+		Ar.SetError();
+	else
+		Ar.Seek(FieldEnd);
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "Text/Encoding.h"
+
+#include "Text/Transcoder.h"
+
+namespace
+{
+	template<typename CharType>
+	TArray<CharType> SwapByteOrder(const CharType* Chars, int32 Length)
+	{
+		TArray<CharType> swapped;
+		swapped.SetNumUninitialized(Length);
+
+		for (int32 i = 0; i < Length; ++i)
+		{
+			const uint32 unit = static_cast<uint32>(Chars[i]);
+
+			if constexpr (sizeof(CharType) == 2)
+				swapped[i] = static_cast<CharType>(((unit & 0xFF) << 8) | (unit >> 8));
+			else
+				swapped[i] = static_cast<CharType>((unit << 24) | ((unit & 0xFF00) << 8) | ((unit >> 8) & 0xFF00) | (unit >> 24));
+		}
+
+		return swapped;
+	}
+
+	template<typename CharType>
+	TArray<uint8> ToUnitBytes(const FString& String)
+	{
+		const int32 length = FTranscoder::GetConvertedLength<CharType>(*String, String.Length());
+
+		TArray<uint8> bytes;
+		bytes.SetNumUninitialized(length * static_cast<int32>(sizeof(CharType)));
+
+		FTranscoder::Convert(reinterpret_cast<CharType*>(bytes.GetData()), length, *String, String.Length());
+		return bytes;
+	}
+}
+
+template<typename CharType>
+FString FEncoding::FromChars(const CharType* Chars, int32 Length)
+{
+	FString result;
+
+	// Counted first, so the string is allocated once with its exact size
+	const int32 length = FTranscoder::GetConvertedLength<TCHAR>(Chars, Length);
+	if (length == 0)
+		return result;
+
+	result.Allocate(length);
+	FTranscoder::Convert(result.m_Data.GetData(), length, Chars, Length);
+
+	result.m_Data[length] = TEXT('\0');
+	result.m_Length = length;
+
+	return result;
+}
+
+FString FEncoding::FromBytes(const TArray<uint8>& Bytes)
+{
+	return FromBytes(Bytes.GetData(), Bytes.Num(), EEncoding::None);
+}
+
+TArray<uint8> FEncoding::ToBytes(const FString& String)
+{
+	return ToUnitBytes<CHAR8>(String);
+}
+
+FString FEncoding::FromBytes(const uint8* Bytes, int32 NumBytes, EEncoding Encoding)
+{
+	int32 bomSize = 0;
+	bool bBigEndian = false;
+	const EEncoding detectedEncoding = DetectEncoding(Bytes, NumBytes, bomSize, bBigEndian);
+
+	if (Encoding == EEncoding::None)
+	{
+		Encoding = detectedEncoding != EEncoding::None ? detectedEncoding : EEncoding::UTF8;
+	}
+	else if (detectedEncoding != Encoding)
+	{
+		// The mark of another encoding is part of the text
+		bomSize = 0;
+		bBigEndian = false;
+	}
+
+	Bytes += bomSize;
+	NumBytes -= bomSize;
+
+	// An incomplete unit at the end is dropped
+	switch (Encoding)
+	{
+	case EEncoding::UTF16:
+		if (bBigEndian)
+			return FromChars(SwapByteOrder(reinterpret_cast<const CHAR16*>(Bytes), NumBytes / 2).GetData(), NumBytes / 2);
+
+		return FromChars(reinterpret_cast<const CHAR16*>(Bytes), NumBytes / 2);
+
+	case EEncoding::UTF32:
+		if (bBigEndian)
+			return FromChars(SwapByteOrder(reinterpret_cast<const CHAR32*>(Bytes), NumBytes / 4).GetData(), NumBytes / 4);
+
+		return FromChars(reinterpret_cast<const CHAR32*>(Bytes), NumBytes / 4);
+
+	default:
+		return FromChars(reinterpret_cast<const CHAR8*>(Bytes), NumBytes);
+	}
+}
+
+TArray<uint8> FEncoding::ToBytes(const FString& String, EEncoding Encoding)
+{
+	switch (Encoding)
+	{
+	case EEncoding::UTF16:
+		return ToUnitBytes<CHAR16>(String);
+	case EEncoding::UTF32:
+		return ToUnitBytes<CHAR32>(String);
+	default:
+		return ToUnitBytes<CHAR8>(String);
+	}
+}
+
+EEncoding FEncoding::DetectEncoding(const uint8* Bytes, int32 NumBytes, int32& OutBOMSize, bool& bOutBigEndian)
+{
+	OutBOMSize = 0;
+	bOutBigEndian = false;
+
+	// UTF-32 first, its little endian mark starts with the one of UTF-16
+	if (NumBytes >= 4 && Bytes[0] == 0xFF && Bytes[1] == 0xFE && Bytes[2] == 0x00 && Bytes[3] == 0x00)
+	{
+		OutBOMSize = 4;
+		return EEncoding::UTF32;
+	}
+
+	if (NumBytes >= 4 && Bytes[0] == 0x00 && Bytes[1] == 0x00 && Bytes[2] == 0xFE && Bytes[3] == 0xFF)
+	{
+		OutBOMSize = 4;
+		bOutBigEndian = true;
+		return EEncoding::UTF32;
+	}
+
+	if (NumBytes >= 3 && Bytes[0] == 0xEF && Bytes[1] == 0xBB && Bytes[2] == 0xBF)
+	{
+		OutBOMSize = 3;
+		return EEncoding::UTF8;
+	}
+
+	if (NumBytes >= 2 && ((Bytes[0] == 0xFF && Bytes[1] == 0xFE) || (Bytes[0] == 0xFE && Bytes[1] == 0xFF)))
+	{
+		OutBOMSize = 2;
+		bOutBigEndian = Bytes[0] == 0xFE;
+		return EEncoding::UTF16;
+	}
+
+	return EEncoding::None;
+}
\ No newline at end of file
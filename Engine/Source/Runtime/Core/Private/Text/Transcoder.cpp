@@ -0,0 +1,385 @@
+#include "Text/Transcoder.h"
+
+#include "Math/Math.h"
+#include "Memory/Memory.h"
+
+#if PLATFORM_WINDOWS && (PLATFORM_X64 || PLATFORM_X86)
+#include <emmintrin.h>
+#define IE_TRANSCODER_SIMD 1
+#else
+#define IE_TRANSCODER_SIMD 0
+#endif
+
+namespace
+{
+	template<int32 Size>
+	struct TCharUnit;
+
+	template<> struct TCharUnit<1> { typedef uint8 Type; };
+	template<> struct TCharUnit<2> { typedef uint16 Type; };
+	template<> struct TCharUnit<4> { typedef uint32 Type; };
+
+	template<typename CharType>
+	FORCEINLINE typename TCharUnit<sizeof(CharType)>::Type* ToUnits(CharType* InData)
+	{
+		return reinterpret_cast<typename TCharUnit<sizeof(CharType)>::Type*>(InData);
+	}
+
+	template<typename CharType>
+	FORCEINLINE const typename TCharUnit<sizeof(CharType)>::Type* ToUnits(const CharType* InData)
+	{
+		return reinterpret_cast<const typename TCharUnit<sizeof(CharType)>::Type*>(InData);
+	}
+
+	// Returned by the decoders for invalid sequences, never a code point
+	constexpr uint32 InvalidChar = 0xFFFFFFFF;
+
+	// Decodes a UTF-8 sequence, the allowed ranges of the bytes follow table 3-7 of the Unicode standard,
+	// which rules out overlong forms, surrogates and code points above U+10FFFF.
+	// An invalid sequence consumes its longest valid prefix, at least the lead byte.
+	FORCEINLINE uint32 Decode(const uint8*& InOutSource, const uint8* InEnd)
+	{
+		const uint32 lead = *InOutSource++;
+		if (lead < 0x80)
+			return lead;
+
+		uint32 codePoint;
+		int32 numTrailing;
+		uint32 lower = 0x80;
+		uint32 upper = 0xBF;
+
+		if (lead >= 0xC2 && lead <= 0xDF)
+		{
+			codePoint = lead & 0x1F;
+			numTrailing = 1;
+		}
+		else if (lead >= 0xE0 && lead <= 0xEF)
+		{
+			codePoint = lead & 0x0F;
+			numTrailing = 2;
+			lower = lead == 0xE0 ? 0xA0 : 0x80;
+			upper = lead == 0xED ? 0x9F : 0xBF;
+		}
+		else if (lead >= 0xF0 && lead <= 0xF4)
+		{
+			codePoint = lead & 0x07;
+			numTrailing = 3;
+			lower = lead == 0xF0 ? 0x90 : 0x80;
+			upper = lead == 0xF4 ? 0x8F : 0xBF;
+		}
+		else
+		{
+			return InvalidChar;
+		}
+
+		for (int32 i = 0; i < numTrailing; ++i)
+		{
+			if (InOutSource == InEnd || *InOutSource < lower || *InOutSource > upper)
+				return InvalidChar;
+
+			codePoint = (codePoint << 6) | (*InOutSource++ & 0x3F);
+			lower = 0x80;
+			upper = 0xBF;
+		}
+
+		return codePoint;
+	}
+
+	FORCEINLINE uint32 Decode(const uint16*& InOutSource, const uint16* InEnd)
+	{
+		const uint32 unit = *InOutSource++;
+		if (unit < 0xD800 || unit > 0xDFFF)
+			return unit;
+
+		// A high surrogate followed by a low one
+		if (unit <= 0xDBFF && InOutSource != InEnd && *InOutSource >= 0xDC00 && *InOutSource <= 0xDFFF)
+			return 0x10000 + ((unit - 0xD800) << 10) + (*InOutSource++ - 0xDC00);
+
+		return InvalidChar;
+	}
+
+	FORCEINLINE uint32 Decode(const uint32*& InOutSource, const uint32*)
+	{
+		const uint32 codePoint = *InOutSource++;
+		return codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF) ? InvalidChar : codePoint;
+	}
+
+	template<typename UnitType>
+	FORCEINLINE int32 GetEncodedLength(uint32 CodePoint)
+	{
+		if constexpr (sizeof(UnitType) == 1)
+			return CodePoint < 0x80 ? 1 : CodePoint < 0x800 ? 2 : CodePoint < 0x10000 ? 3 : 4;
+		else if constexpr (sizeof(UnitType) == 2)
+			return CodePoint < 0x10000 ? 1 : 2;
+		else
+			return 1;
+	}
+
+	FORCEINLINE void Encode(uint8* Dest, uint32 CodePoint)
+	{
+		if (CodePoint < 0x80)
+		{
+			Dest[0] = static_cast<uint8>(CodePoint);
+		}
+		else if (CodePoint < 0x800)
+		{
+			Dest[0] = static_cast<uint8>(0xC0 | (CodePoint >> 6));
+			Dest[1] = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			Dest[0] = static_cast<uint8>(0xE0 | (CodePoint >> 12));
+			Dest[1] = static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F));
+			Dest[2] = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+		}
+		else
+		{
+			Dest[0] = static_cast<uint8>(0xF0 | (CodePoint >> 18));
+			Dest[1] = static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F));
+			Dest[2] = static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F));
+			Dest[3] = static_cast<uint8>(0x80 | (CodePoint & 0x3F));
+		}
+	}
+
+	FORCEINLINE void Encode(uint16* Dest, uint32 CodePoint)
+	{
+		if (CodePoint < 0x10000)
+		{
+			Dest[0] = static_cast<uint16>(CodePoint);
+		}
+		else
+		{
+			Dest[0] = static_cast<uint16>(0xD800 + ((CodePoint - 0x10000) >> 10));
+			Dest[1] = static_cast<uint16>(0xDC00 + ((CodePoint - 0x10000) & 0x3FF));
+		}
+	}
+
+	FORCEINLINE void Encode(uint32* Dest, uint32 CodePoint)
+	{
+		Dest[0] = CodePoint;
+	}
+
+#if IE_TRANSCODER_SIMD
+
+	// @return True if all units of the vector are ASCII
+	template<typename SourceUnit>
+	FORCEINLINE bool IsAscii(__m128i InVector)
+	{
+		if constexpr (sizeof(SourceUnit) == 1)
+			return _mm_movemask_epi8(InVector) == 0;
+		else if constexpr (sizeof(SourceUnit) == 2)
+			return _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(InVector, _mm_set1_epi16(static_cast<int16>(0xFF80))), _mm_setzero_si128())) == 0xFFFF;
+		else
+			return _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(InVector, _mm_set1_epi32(static_cast<int32>(0xFFFFFF80))), _mm_setzero_si128())) == 0xFFFF;
+	}
+
+	// Stores the ASCII units of a vector as target units, widened or narrowed
+	template<typename TargetUnit, typename SourceUnit>
+	FORCEINLINE void StoreAscii(TargetUnit* Dest, __m128i InVector)
+	{
+		const __m128i zero = _mm_setzero_si128();
+
+		if constexpr (sizeof(TargetUnit) == sizeof(SourceUnit))
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest), InVector);
+		}
+		else if constexpr (sizeof(SourceUnit) == 1)
+		{
+			const __m128i low = _mm_unpacklo_epi8(InVector, zero);
+			const __m128i high = _mm_unpackhi_epi8(InVector, zero);
+
+			if constexpr (sizeof(TargetUnit) == 2)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest), low);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + 8), high);
+			}
+			else
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest), _mm_unpacklo_epi16(low, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + 4), _mm_unpackhi_epi16(low, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + 8), _mm_unpacklo_epi16(high, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + 12), _mm_unpackhi_epi16(high, zero));
+			}
+		}
+		else if constexpr (sizeof(SourceUnit) == 2)
+		{
+			if constexpr (sizeof(TargetUnit) == 1)
+			{
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(Dest), _mm_packus_epi16(InVector, InVector));
+			}
+			else
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest), _mm_unpacklo_epi16(InVector, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + 4), _mm_unpackhi_epi16(InVector, zero));
+			}
+		}
+		else
+		{
+			// ASCII values don't saturate when packed
+			const __m128i packed = _mm_packs_epi32(InVector, InVector);
+
+			if constexpr (sizeof(TargetUnit) == 1)
+			{
+				const int32 bytes = _mm_cvtsi128_si32(_mm_packus_epi16(packed, packed));
+				FMemory::Memcpy(Dest, &bytes, 4);
+			}
+			else
+			{
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(Dest), packed);
+			}
+		}
+	}
+
+#endif
+
+	// @return The number of leading ASCII units
+	template<typename SourceUnit>
+	FORCEINLINE int32 SkipAscii(const SourceUnit* Source, int32 Length)
+	{
+		int32 i = 0;
+
+#if IE_TRANSCODER_SIMD
+		constexpr int32 numPerVector = 16 / sizeof(SourceUnit);
+
+		for (; i + numPerVector <= Length; i += numPerVector)
+		{
+			if (!IsAscii<SourceUnit>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i))))
+				break;
+		}
+#endif
+
+		while (i < Length && Source[i] < 0x80)
+			++i;
+
+		return i;
+	}
+
+	// Copies the leading ASCII units
+	// @return The number of units copied
+	template<typename TargetUnit, typename SourceUnit>
+	FORCEINLINE int32 CopyAscii(TargetUnit* Dest, const SourceUnit* Source, int32 Length)
+	{
+		int32 i = 0;
+
+#if IE_TRANSCODER_SIMD
+		constexpr int32 numPerVector = 16 / sizeof(SourceUnit);
+
+		for (; i + numPerVector <= Length; i += numPerVector)
+		{
+			const __m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + i));
+			if (!IsAscii<SourceUnit>(vector))
+				break;
+
+			StoreAscii<TargetUnit, SourceUnit>(Dest + i, vector);
+		}
+#endif
+
+		for (; i < Length && Source[i] < 0x80; ++i)
+			Dest[i] = static_cast<TargetUnit>(Source[i]);
+
+		return i;
+	}
+
+	template<typename TargetUnit, typename SourceUnit>
+	int32 CountConverted(const SourceUnit* Source, int32 Length)
+	{
+		const SourceUnit* end = Source + Length;
+		int32 count = 0;
+
+		while (Source != end)
+		{
+			const int32 numAscii = SkipAscii(Source, static_cast<int32>(end - Source));
+			Source += numAscii;
+			count += numAscii;
+
+			while (Source != end && *Source >= 0x80)
+			{
+				const uint32 codePoint = Decode(Source, end);
+				count += GetEncodedLength<TargetUnit>(codePoint != InvalidChar ? codePoint : FTranscoder::ReplacementChar);
+			}
+		}
+
+		return count;
+	}
+
+	template<typename TargetUnit, typename SourceUnit>
+	int32 ConvertUnits(TargetUnit* Dest, int32 DestCapacity, const SourceUnit* Source, int32 Length)
+	{
+		const SourceUnit* end = Source + Length;
+		TargetUnit* dest = Dest;
+		TargetUnit* const destEnd = Dest + DestCapacity;
+
+		while (Source != end && dest != destEnd)
+		{
+			const int32 numAscii = CopyAscii(dest, Source, static_cast<int32>(FMath::Min(end - Source, destEnd - dest)));
+			Source += numAscii;
+			dest += numAscii;
+
+			while (Source != end && *Source >= 0x80)
+			{
+				uint32 codePoint = Decode(Source, end);
+				if (codePoint == InvalidChar)
+					codePoint = FTranscoder::ReplacementChar;
+
+				const int32 encodedLength = GetEncodedLength<TargetUnit>(codePoint);
+				if (encodedLength > destEnd - dest)
+					return static_cast<int32>(dest - Dest);
+
+				Encode(dest, codePoint);
+				dest += encodedLength;
+			}
+		}
+
+		return static_cast<int32>(dest - Dest);
+	}
+}
+
+template<typename TargetType, typename SourceType>
+int32 FTranscoder::GetConvertedLength(const SourceType* Source, int32 SourceLength)
+{
+	return CountConverted<typename TCharUnit<sizeof(TargetType)>::Type>(ToUnits(Source), SourceLength);
+}
+
+template<typename TargetType, typename SourceType>
+int32 FTranscoder::Convert(TargetType* Dest, int32 DestCapacity, const SourceType* Source, int32 SourceLength)
+{
+	return ConvertUnits(ToUnits(Dest), DestCapacity, ToUnits(Source), SourceLength);
+}
+
+template<typename CharType>
+bool FTranscoder::IsValid(const CharType* Source, int32 Length)
+{
+	const auto* units = ToUnits(Source);
+	const auto* end = units + Length;
+
+	while (units != end)
+	{
+		units += SkipAscii(units, static_cast<int32>(end - units));
+
+		while (units != end && *units >= 0x80)
+		{
+			if (Decode(units, end) == InvalidChar)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+#define IE_TRANSCODER_INSTANTIATE_PAIR(TargetType, SourceType) \
+	template int32 FTranscoder::GetConvertedLength<TargetType, SourceType>(const SourceType*, int32); \
+	template int32 FTranscoder::Convert<TargetType, SourceType>(TargetType*, int32, const SourceType*, int32);
+
+#define IE_TRANSCODER_INSTANTIATE(SourceType) \
+	IE_TRANSCODER_INSTANTIATE_PAIR(ANSICHAR, SourceType) \
+	IE_TRANSCODER_INSTANTIATE_PAIR(WIDECHAR, SourceType) \
+	IE_TRANSCODER_INSTANTIATE_PAIR(CHAR8, SourceType) \
+	IE_TRANSCODER_INSTANTIATE_PAIR(CHAR16, SourceType) \
+	IE_TRANSCODER_INSTANTIATE_PAIR(CHAR32, SourceType) \
+	template bool FTranscoder::IsValid<SourceType>(const SourceType*, int32);
+
+IE_TRANSCODER_INSTANTIATE(ANSICHAR)
+IE_TRANSCODER_INSTANTIATE(WIDECHAR)
+IE_TRANSCODER_INSTANTIATE(CHAR8)
+IE_TRANSCODER_INSTANTIATE(CHAR16)
+IE_TRANSCODER_INSTANTIATE(CHAR32)
\ No newline at end of file
@@ -84,4 +84,21 @@ FAtomic64 FWindowsAtomics::InterlockedXor64(FAtomic64 volatile* ValuePtr, FAtomi
 	return ::_InterlockedXor64(ValuePtr, Value);
 }
 
+FAtomic FWindowsAtomics::AtomicRead(FAtomic volatile const* ValuePtr)
+{
+	// Aligned loads are atomic on x86/x64, the barrier keeps the compiler from reordering around the load
+	const FAtomic value = *ValuePtr;
+	::_ReadWriteBarrier();
+
+	return value;
+}
+
+FAtomic64 FWindowsAtomics::AtomicRead64(FAtomic64 volatile const* ValuePtr)
+{
+	const FAtomic64 value = *ValuePtr;
+	::_ReadWriteBarrier();
+
+	return value;
+}
+
 #endif
\ No newline at end of file
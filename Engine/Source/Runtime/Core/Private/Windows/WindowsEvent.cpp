@@ -0,0 +1,33 @@
+#include "Windows/WindowsEvent.h"
+
+#if PLATFORM_WINDOWS
+
+#include "Windows/WindowsAPI.h"
+
+FWindowsEvent::FWindowsEvent(bool bManualReset)
+{
+	m_Event = CreateEventW(NULL, bManualReset ? TRUE : FALSE, FALSE, NULL);
+}
+
+FWindowsEvent::~FWindowsEvent()
+{
+	if (m_Event)
+		CloseHandle(m_Event);
+}
+
+void FWindowsEvent::Trigger()
+{
+	SetEvent(m_Event);
+}
+
+void FWindowsEvent::Reset()
+{
+	ResetEvent(m_Event);
+}
+
+bool FWindowsEvent::Wait(uint32 WaitTime)
+{
+	return WaitForSingleObject(m_Event, WaitTime == 0 ? INFINITE : (DWORD)WaitTime) == WAIT_OBJECT_0;
+}
+
+#endif
\ No newline at end of file
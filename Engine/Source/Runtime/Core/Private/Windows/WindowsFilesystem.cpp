@@ -1,5 +1,7 @@
 #include "Windows/WindowsFilesystem.h"
 
+#include "Math/Math.h"
+
 #if PLATFORM_WINDOWS
 
 #include <Windows/WindowsAPI.h>
@@ -100,24 +102,62 @@ void FWindowsFilesystem::CloseFile(FFileHandle Handle)
 	CloseHandle(Handle);
 }
 
-bool FWindowsFilesystem::WriteData(FFileHandle Handle, const void* Data, uint64 Size)
+// ReadFile/WriteFile can only transfer less than 4 GiB per call
+static constexpr uint64 MaxBytesPerCall = 1ull << 30;
+
+bool FWindowsFilesystem::WriteData(FFileHandle Handle, const void* Data, uint64 Size, const FGenericWriteFileOptions& Options)
 {
-	DWORD bytesWritten = 0;
+	const uint8* data = static_cast<const uint8*>(Data);
+	uint64 offset = Options.Offset;
+
+	while (Size > 0)
+	{
+		const DWORD bytesToWrite = static_cast<DWORD>(FMath::Min(Size, MaxBytesPerCall));
+
+		// Positional writes don't depend on the file pointer, so they can be issued from multiple threads
+		OVERLAPPED overlapped{};
+		overlapped.Offset = static_cast<DWORD>(offset);
+		overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+		const bool bPositional = offset != MAX_uint64;
 
-	const bool bSuccess = WriteFile(Handle, Data, static_cast<DWORD>(Size), &bytesWritten, (LPOVERLAPPED)nullptr);
+		DWORD bytesWritten = 0;
+		if (!WriteFile(Handle, data, bytesToWrite, &bytesWritten, bPositional ? &overlapped : (LPOVERLAPPED)nullptr) || bytesWritten != bytesToWrite)
+			return false;
 
-	return bSuccess && bytesWritten == Size;
+		data += bytesWritten;
+		Size -= bytesWritten;
+
+		if (bPositional)
+			offset += bytesWritten;
+	}
+
+	return true;
 }
 
 bool FWindowsFilesystem::ReadData(FFileHandle Handle, void* Data, uint64 Size, const FGenericReadFileOptions& Options)
 {
-	OVERLAPPED overlapped{};
-	overlapped.Offset = static_cast<DWORD>(Options.Offset);
+	uint8* data = static_cast<uint8*>(Data);
+	uint64 offset = Options.Offset;
 
-	DWORD bytesRead = 0;
-	const bool bSuccess = ReadFile(Handle, Data, static_cast<DWORD>(Size), &bytesRead, &overlapped);
+	while (Size > 0)
+	{
+		OVERLAPPED overlapped{};
+		overlapped.Offset = static_cast<DWORD>(offset);
+		overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
 
-	return bSuccess && bytesRead == Size;
+		const DWORD bytesToRead = static_cast<DWORD>(FMath::Min(Size, MaxBytesPerCall));
+
+		DWORD bytesRead = 0;
+		if (!ReadFile(Handle, data, bytesToRead, &bytesRead, &overlapped) || bytesRead != bytesToRead)
+			return false;
+
+		data += bytesRead;
+		offset += bytesRead;
+		Size -= bytesRead;
+	}
+
+	return true;
 }
 
 FString FWindowsFilesystem::GetSpecialDirectory(ESpecialDirectory Directory)
@@ -135,8 +175,11 @@ FString FWindowsFilesystem::GetSpecialDirectory(ESpecialDirectory Directory)
 
 uint64 FWindowsFilesystem::GetFileSize(FFileHandle Handle)
 {
-	DWORD size = 0;
-	return ::GetFileSize(Handle, &size);
+	LARGE_INTEGER size{};
+	if (!::GetFileSizeEx(Handle, &size))
+		return 0;
+
+	return static_cast<uint64>(size.QuadPart);
 }
 
 bool FWindowsFilesystem::IsFile(const FString& Path)
@@ -166,6 +209,169 @@ bool FWindowsFilesystem::CreateDirectory(const FString& Directory)
 	return CreateDirectoryW(*Directory, NULL);
 }
 
+FWindowsMappedFileRegion::FWindowsMappedFileRegion(FWindowsMappedFileRegion&& Other) noexcept
+	: MappedBase(Other.MappedBase), Data(Other.Data), Size(Other.Size), Offset(Other.Offset), bWritable(Other.bWritable)
+{
+	Other.MappedBase = nullptr;
+	Other.Data = nullptr;
+	Other.Size = 0;
+	Other.Offset = 0;
+	Other.bWritable = false;
+}
+
+FWindowsMappedFileRegion::~FWindowsMappedFileRegion()
+{
+	Unmap();
+}
+
+FWindowsMappedFileRegion& FWindowsMappedFileRegion::operator=(FWindowsMappedFileRegion&& Other) noexcept
+{
+	if (this != &Other)
+	{
+		Unmap();
+
+		MappedBase = Other.MappedBase;
+		Data = Other.Data;
+		Size = Other.Size;
+		Offset = Other.Offset;
+		bWritable = Other.bWritable;
+
+		Other.MappedBase = nullptr;
+		Other.Data = nullptr;
+		Other.Size = 0;
+		Other.Offset = 0;
+		Other.bWritable = false;
+	}
+
+	return *this;
+}
+
+bool FWindowsMappedFileRegion::Prefetch(uint64 InOffset, uint64 InSize) const
+{
+	if (!IsValid() || InOffset >= Size)
+		return false;
+
+	WIN32_MEMORY_RANGE_ENTRY range{};
+	range.VirtualAddress = const_cast<uint8*>(Data + InOffset);
+	range.NumberOfBytes = static_cast<SIZE_T>(InSize == 0 ? Size - InOffset : FMath::Min(InSize, Size - InOffset));
+
+	return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+void FWindowsMappedFileRegion::Unmap()
+{
+	if (MappedBase)
+		UnmapViewOfFile(MappedBase);
+
+	MappedBase = nullptr;
+	Data = nullptr;
+	Size = 0;
+	Offset = 0;
+	bWritable = false;
+}
+
+FWindowsMappedFileHandle::~FWindowsMappedFileHandle()
+{
+	Close();
+}
+
+bool FWindowsMappedFileHandle::Open(const FString& Filename, EMappedFileAccess InAccess)
+{
+	Close();
+
+	HANDLE file = CreateFileW(*Filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (!Windows::IsValidHandle(file))
+		return false;
+
+	LARGE_INTEGER size{};
+	if (!GetFileSizeEx(file, &size))
+	{
+		CloseHandle(file);
+		return false;
+	}
+
+	// Empty files can't be mapped, but opening them is still valid
+
+	HANDLE mapping = nullptr;
+	if (size.QuadPart > 0)
+	{
+		const DWORD protection = InAccess == EMappedFileAccess::CopyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY;
+
+		mapping = CreateFileMappingW(file, NULL, protection, 0, 0, NULL);
+		if (!mapping)
+		{
+			CloseHandle(file);
+			return false;
+		}
+	}
+
+	FileHandle = file;
+	MappingHandle = mapping;
+	FileSize = static_cast<uint64>(size.QuadPart);
+	Access = InAccess;
+
+	return true;
+}
+
+void FWindowsMappedFileHandle::Close()
+{
+	// Mapped views keep a reference to the mapping, so the handles can be closed while regions are still mapped
+
+	if (MappingHandle)
+		CloseHandle(MappingHandle);
+
+	if (FileHandle)
+		CloseHandle(FileHandle);
+
+	FileHandle = nullptr;
+	MappingHandle = nullptr;
+	FileSize = 0;
+}
+
+bool FWindowsMappedFileHandle::MapRegion(FWindowsMappedFileRegion& OutRegion, uint64 InOffset, uint64 InSize) const
+{
+	OutRegion.Unmap();
+
+	if (!MappingHandle || InOffset >= FileSize)
+		return false;
+
+	const uint64 size = InSize == 0 ? FileSize - InOffset : InSize;
+	if (size > FileSize - InOffset || size > static_cast<uint64>(static_cast<SIZE_T>(-1)))
+		return false;
+
+	// Views have to start at a multiple of the allocation granularity
+
+	const uint64 alignedOffset = InOffset & ~(GetMappingAlignment() - 1);
+	const uint64 delta = InOffset - alignedOffset;
+
+	const DWORD desiredAccess = Access == EMappedFileAccess::CopyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ;
+
+	void* view = MapViewOfFile(MappingHandle, desiredAccess, static_cast<DWORD>(alignedOffset >> 32), static_cast<DWORD>(alignedOffset), static_cast<SIZE_T>(size + delta));
+	if (!view)
+		return false;
+
+	OutRegion.MappedBase = view;
+	OutRegion.Data = static_cast<const uint8*>(view) + delta;
+	OutRegion.Size = size;
+	OutRegion.Offset = InOffset;
+	OutRegion.bWritable = Access == EMappedFileAccess::CopyOnWrite;
+
+	return true;
+}
+
+uint64 FWindowsMappedFileHandle::GetMappingAlignment()
+{
+	static const uint64 alignment = []()
+	{
+		SYSTEM_INFO info{};
+		GetSystemInfo(&info);
+
+		return static_cast<uint64>(info.dwAllocationGranularity);
+	}();
+
+	return alignment;
+}
+
 #pragma pop_macro("DeleteFile")
 #pragma pop_macro("MoveFile")
 #pragma pop_macro("CopyFile")
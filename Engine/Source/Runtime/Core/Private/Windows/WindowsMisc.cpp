@@ -72,6 +72,14 @@ double FWindowsPlatformMisc::Seconds()
 	return (double)(CurrentSeconds.QuadPart - StartSeconds.QuadPart) / (double)Frequency.QuadPart;
 }
 
+int32 FWindowsPlatformMisc::NumberOfCores()
+{
+	SYSTEM_INFO info{};
+	GetSystemInfo(&info);
+
+	return info.dwNumberOfProcessors > 0 ? static_cast<int32>(info.dwNumberOfProcessors) : 1;
+}
+
 bool FWindowsPlatformMisc::CoInitialize(bool bSingleThreaded)
 {
 	const DWORD flags = bSingleThreaded ? COINIT_APARTMENTTHREADED : COINIT_MULTITHREADED;
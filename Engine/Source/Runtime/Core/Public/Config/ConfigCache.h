@@ -2,18 +2,20 @@
 
 #include "Containers/Map.h"
 #include "Containers/ImpulseString.h"
+#include "Containers/InternedString.h"
 
 #include "ConfigValues.h"
 
 struct FConfigSection
 {
-	TMap<FString, FConfigValue*> Values;
+	// Keys are interned, the same keys repeat across sections and files
+	TMap<FInternedString, FConfigValue*> Values;
 };
 
 struct FConfigContext
 {
 	FString Filename;
-	TMap<FString, FConfigSection> Sections;
+	TMap<FInternedString, FConfigSection> Sections;
 };
 
 /**
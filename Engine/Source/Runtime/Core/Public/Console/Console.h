@@ -4,6 +4,7 @@
 
 #include "Containers/Map.h"
 #include "Containers/ImpulseString.h"
+#include "Containers/InternedString.h"
 
 class IConsole;
 
@@ -71,14 +72,14 @@ public:
 
 public:
 
-	FString GetName() const { return Name; }
-	FString GetDescription() const { return Description; }
+	const FInternedString& GetName() const { return Name; }
+	const FString& GetDescription() const { return Description; }
 	IConsole* GetConsole() const { return Console; }
 
 protected:
 
-	/** Name which can be used to look up the variable. */
-	const FString Name;
+	/** Name which can be used to look up the variable, case insensitive. */
+	const FInternedString Name;
 
 	/** Description of the variable. */
 	const FString Description;
@@ -194,7 +195,7 @@ public:
 	* @param Name - The name of the command to search for.
 	* @return The command if found, otherwise nullptr.
 	*/
-	virtual IConsoleCommand* FindCommand(const FString& Name) const;
+	virtual IConsoleCommand* FindCommand(FStringView Name) const;
 
 	/**
 	* Searches for commands by name.
@@ -202,14 +203,14 @@ public:
 	* @param OutCommands - Will contain all commands with the given name.
 	* @return The number of commands found.
 	*/
-	virtual int32 FindCommands(const FString& Name, TArray<IConsoleCommand*>& OutCommands) const;
+	virtual int32 FindCommands(FStringView Name, TArray<IConsoleCommand*>& OutCommands) const;
 
 	/**
 	* Searches for a variable by name.
 	* @param Name - The name of the variable to search for.
 	* @return The variable if found, otherwise nullptr.
 	*/
-	virtual IConsoleVariable* FindVariable(const FString& Name) const;
+	virtual IConsoleVariable* FindVariable(FStringView Name) const;
 
 	/**
 	* Searches for variables by name.
@@ -217,7 +218,7 @@ public:
 	* @param OutVariables - Will contain all variables with the given name.
 	* @return The number of variables found.
 	*/
-	virtual int32 FindVariables(const FString& Name, TArray<IConsoleVariable*>& OutVariables) const;
+	virtual int32 FindVariables(FStringView Name, TArray<IConsoleVariable*>& OutVariables) const;
 
 protected:
 
@@ -265,8 +266,8 @@ private:
 	bool bPrintCommandNotFound = true;
 
 	/** List of all registered commands. */
-	TMap<FString, IConsoleCommand*> Commands;
+	TMap<FInternedString, IConsoleCommand*> Commands;
 
 	/** List of all registered variables. */
-	TMap<FString, IConsoleVariable*> Variables;
+	TMap<FInternedString, IConsoleVariable*> Variables;
 };
\ No newline at end of file
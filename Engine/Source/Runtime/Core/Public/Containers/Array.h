@@ -141,6 +141,11 @@ public:
 	// @return Index of the added element.
 	int32 AddUninitialized();
 
+	// Adds uninitialized elements to the end of the array, reserved memory is used if there is enough.
+	// @param Count - Number of elements to add.
+	// @return Index of the first added element.
+	int32 AddUninitialized(int32 Count);
+
 	// Adds an element to the end of the array.
 	// @param Element - Element to add.
 	// @return Index of the added element.
@@ -443,6 +448,21 @@ inline int32 TArray<T, Allocator>::AddUninitialized()
 	return m_Num++;
 }
 
+template<typename T, typename Allocator>
+inline int32 TArray<T, Allocator>::AddUninitialized(int32 Count)
+{
+	checkf(Count >= 0, TEXT("Number of elements to add must not be negative."));
+
+	const int32 reservedNum = GetReservedNum();
+	if (reservedNum < Count)
+		Reserve(Count - reservedNum);
+
+	const int32 index = m_Num;
+	m_Num += Count;
+
+	return index;
+}
+
 template<typename T, typename Allocator>
 inline int32 TArray<T, Allocator>::Add(const T& Element)
 {
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Array.h"
+#include "StringFormat.h"
+#include "StringView.h"
 #include "Platform/PlatformString.h"
 #include "Serialization/Archive.h"
 
@@ -8,12 +10,6 @@
 
 #define STRING_PRINTF_BUFFER_SIZE 512
 
-enum class ESearchDir : uint8
-{
-	FromStart,
-	FromEnd
-};
-
 class CORE_API FString
 {
 	using FPlatformString = TPlatformString<TCHAR>;
@@ -24,6 +20,7 @@ public:
 	FString(const FString&) = default;
 	FString(FString&& Other) noexcept;
 	FString(const TCHAR* InData);
+	explicit FString(FStringView InView);
 
 	FString& operator=(const FString&) = default;
 	FString& operator=(FString&& Other) noexcept;
@@ -54,23 +51,23 @@ public:
 	// @param InSubStr - The substring to search for
 	// @param InSearchCase - Whether or not the search should be case sensitive
 	// @param InSearchDir - The direction to search in
-	// @param InStartIndex - The index to start relative searching from
+	// @param InStartIndex - Number of characters to skip, from the start or the end depending on the direction
 	// @return The index of the first occurrence of the specified character or -1 if not found
-	int32 Find(const FString& InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive, ESearchDir InSearchDir = ESearchDir::FromStart, int32 InStartIndex = 0) const;
+	int32 Find(FStringView InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive, ESearchDir InSearchDir = ESearchDir::FromStart, int32 InStartIndex = 0) const;
 
 	// Finds all occurrences of the specified substring
 	// @param InSubStr - The substring to search for
 	// @param InSearchCase - Whether or not the search should be case sensitive
 	// @param InSearchDir - The direction to search in
-	// @param InStartIndex - The index to start relative searching from
+	// @param InStartIndex - Number of characters to skip, from the start or the end depending on the direction
 	// @return The indices of all occurrences of the specified substring
-	TArray<int32> FindAll(const FString& InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive, ESearchDir InSearchDir = ESearchDir::FromStart, int32 InStartIndex = 0) const;
+	TArray<int32> FindAll(FStringView InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive, ESearchDir InSearchDir = ESearchDir::FromStart, int32 InStartIndex = 0) const;
 
 	// Checks whether or not the string contains the specified substring
 	// @param InSubStr - The substring to search for
 	// @param InSearchCase - Whether or not the search should be case sensitive
 	// @return True if the string contains the specified substring, false otherwise
-	bool Contains(const FString& InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const;
+	bool Contains(FStringView InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const;
 
 	/**
 	* Checks whether or not the string contains the specified character
@@ -84,19 +81,19 @@ public:
 	// @param InSubStr - The substring to search for
 	// @param InSearchCase - Whether or not the search should be case sensitive
 	// @return True if the string starts with the specified substring, false otherwise
-	bool StartsWith(const FString& InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const;
+	bool StartsWith(FStringView InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const;
 
 	// Checks whether or not the string ends with the specified substring
 	// @param InSubStr - The substring to search for
 	// @param InSearchCase - Whether or not the search should be case sensitive
 	// @return True if the string ends with the specified substring, false otherwise
-	bool EndsWith(const FString& InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const;
+	bool EndsWith(FStringView InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const;
 
 	// Checks whether two strings are equal
 	// @param InOther - The string to compare to
 	// @param InSearchCase - Whether or not the comparison should be case sensitive
 	// @return True if the strings are equal, false otherwise
-	bool Equals(const FString& InOther, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const;
+	bool Equals(FStringView InOther, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const;
 
 	// Checks whether or not the string is null or empty
 	// @return True if the string is null or empty, false otherwise
@@ -135,7 +132,7 @@ public:
 
 	// Trims the beginning and end of the string
 	// @param InTrimChars - The characters to trim
-	// @return A new string with the specified characters trimmed from the beginning and end
+	// @return A new string with the specified characters trimmed from the beginning and end, trim an FStringView or FSharedString to avoid the copy
 	FString Trim(const TCHAR* InTrimChars = nullptr) const;
 
 	// Appends the specified string to the end of the string
@@ -159,6 +156,9 @@ public:
 	FORCEINLINE TCHAR* operator*() { return m_Data.GetData(); }
 	FORCEINLINE const TCHAR* operator*() const { return m_Data.GetData(); }
 
+	// @return View of the characters, valid until the string is modified
+	FORCEINLINE operator FStringView() const { return FStringView(m_Data.GetData(), m_Length); }
+
 	FORCEINLINE TCHAR& operator[](int32 InIndex) { return m_Data[InIndex]; }
 	FORCEINLINE const TCHAR& operator[](int32 InIndex) const { return m_Data[InIndex]; }
 
@@ -186,6 +186,15 @@ public:
 	*/
 	static FString Printf(const TCHAR* InFormat, ...);
 
+	/**
+	* Formats a string with {} placeholders, the arguments are written without temporary strings.
+	* Prefer it to Printf, the format string is validated against the arguments at compile time, see TFormatString.
+	* @param InFormat - The format string
+	* @param InArgs - The arguments
+	*/
+	template<typename... ArgTypes>
+	static FString Format(TFormatString<TCHAR, typename TIdentity<ArgTypes>::Type...> InFormat, const ArgTypes&... InArgs);
+
 public:
 
 	/**
@@ -381,6 +390,7 @@ public:
 	/**
 	* Makes a string from a float
 	* @param InValue - The float value
+	* @param MinFractionalDigits - Maximum number of fractional digits, all digits that convert back to the same value if 0
 	* @return The string
 	*/
 	static FString FromFloat(float InValue, int32 MinFractionalDigits = 10);
@@ -388,6 +398,7 @@ public:
 	/**
 	* Makes a string from a float
 	* @param InValue - The float value
+	* @param MinFractionalDigits - Maximum number of fractional digits, all digits that convert back to the same value if 0
 	* @return The string
 	*/
 	static FString FromDouble(double InValue, int32 MinFractionalDigits = 10);
@@ -396,6 +407,8 @@ public:
 
 	/**
 	* Serializes a string.
+	* Strings whose characters all fit into one byte are saved with one byte per character, others with TCHARs.
+	* The length is validated against the size of the archive before anything is allocated.
 	* String will be encrypted by default.
 	* To disable encryption, you have to rebuild the engine with the IE_DISABLE_STRING_ENCRYPTION macro defined.
 	*/
@@ -408,15 +421,15 @@ public:
 
 private:
 
+	friend class FVariant;
+	friend class FEncoding;
+
 	// Resizes the string to the specified number of characters
 	// @param InNum The number of characters to resize the string to without null terminator
 	void Allocate(int32 InNum);
 
 	void Copy(const TCHAR* InData, int32 InNum);
 
-	int32 FindForward(const TCHAR* InSubStr, int32 InSubStrLength, int32 InStartIndex, ESearchCase SearchCase) const;
-	int32 FindBackward(const TCHAR* InSubStr, int32 InSubStrLength, int32 InStartIndex, ESearchCase SearchCase) const;
-
 	int32 m_Length = 0;
 	TArray<TCHAR> m_Data;
 };
@@ -424,4 +437,7 @@ private:
 inline uint32 GetTypeHash(const FString& InString)
 {
 	return GetTypeHash(*InString, InString.Length());
-}
\ No newline at end of file
+}
+
+// After FString, the builder defines FString::Format
+#include "StringBuilder.h"
\ No newline at end of file
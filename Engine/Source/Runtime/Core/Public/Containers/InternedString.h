@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreModule.h"
+
+#include "Name.h"
+
+/**
+* A string stored once in the global string pool.
+* Entries are never freed, pointers to them stay valid for the lifetime of the program.
+*/
+struct FInternedStringEntry
+{
+	/** Entry of the first casing of the string that was interned, shared by all casings. */
+	const FInternedStringEntry* Comparison;
+
+	/** Case insensitive hash of the characters, the same as GetTypeHash of an FString. */
+	uint32 Hash;
+
+	/** Number of characters without null terminator. */
+	int32 Length;
+
+	/** The null terminated characters, allocated together with the entry. */
+	TCHAR Chars[1];
+};
+
+/**
+* Immutable string whose characters are stored once in a global pool shared by all threads.
+* Case preserving, but equality and hashing ignore case and are O(1), which makes it a cheap map key for names that repeat a lot.
+* Casings are linked with the folding of GetTypeHash, which only folds ASCII letters, so unlike FString::Equals with IgnoreCase
+* non-ASCII case variants such as "É" and "é" stay different strings.
+* The pool is split into shards by hash, each with its own lock, so interning from several threads rarely contends.
+*/
+class CORE_API FInternedString
+{
+public:
+
+	FInternedString() = default;
+
+	/**
+	* Interns a string.
+	* @param InSearchMode - With FindOnly the string is empty unless exactly these characters were interned before, see FindAnyCasing.
+	*/
+	FInternedString(const TCHAR* InString, ENameSearchMode InSearchMode = ENameSearchMode::FindOrAdd);
+	explicit FInternedString(FStringView InString, ENameSearchMode InSearchMode = ENameSearchMode::FindOrAdd);
+	explicit FInternedString(const FString& InString, ENameSearchMode InSearchMode = ENameSearchMode::FindOrAdd);
+
+	FInternedString(const FInternedString& Other) = default;
+	FInternedString& operator=(const FInternedString& Other) = default;
+
+	// Ignores the case of ASCII letters only, see the class comment
+	FORCEINLINE bool operator==(const FInternedString& Other) const { return GetComparison() == Other.GetComparison(); }
+	FORCEINLINE bool operator!=(const FInternedString& Other) const { return GetComparison() != Other.GetComparison(); }
+
+public:
+
+	// @return True if the strings are equal, O(1) for both cases. IgnoreCase only ignores the case of ASCII letters.
+	FORCEINLINE bool Equals(const FInternedString& Other, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const
+	{
+		return InSearchCase == ESearchCase::CaseSensitive ? m_Entry == Other.m_Entry : GetComparison() == Other.GetComparison();
+	}
+
+	FORCEINLINE bool IsEmpty() const { return !m_Entry; }
+	FORCEINLINE int32 Length() const { return m_Entry ? m_Entry->Length : 0; }
+
+	// @return The null terminated characters, valid for the lifetime of the program
+	FORCEINLINE const TCHAR* operator*() const { return m_Entry ? m_Entry->Chars : TEXT(""); }
+
+	FORCEINLINE FStringView ToView() const { return m_Entry ? FStringView(m_Entry->Chars, m_Entry->Length) : FStringView(); }
+	FORCEINLINE FString ToString() const { return m_Entry ? FString(ToView()) : FString(); }
+
+public:
+
+	/**
+	* Finds the string if it was interned before in this or another casing, never adds it.
+	* The result may have another casing, so it is only meant for equality and hashing, e.g. to look up a case insensitive map.
+	* @return The interned string, empty if no casing of the characters was interned.
+	*/
+	static FInternedString FindAnyCasing(FStringView InString);
+
+	/**
+	* Gets the number of unique strings in the pool.
+	* @return The number of entries, every casing counts.
+	*/
+	static int32 GetNumInterned();
+
+private:
+
+	FORCEINLINE const FInternedStringEntry* GetComparison() const { return m_Entry ? m_Entry->Comparison : nullptr; }
+
+	const FInternedStringEntry* m_Entry = nullptr;
+
+public:
+
+	friend uint32 GetTypeHash(const FInternedString& String)
+	{
+		return String.m_Entry ? String.m_Entry->Hash : 0;
+	}
+};
+
+// Lets interned strings be formatted by FString::Format and TStringBuilderWithBuffer::AppendFormat
+template<int32 InlineCapacity>
+inline void AppendFormatArg(TStringBuilderWithBuffer<TCHAR, InlineCapacity>& Builder, const FInternedString& InString)
+{
+	Builder.Append(InString.ToView());
+}
\ No newline at end of file
@@ -204,6 +204,32 @@ public:
 		return FindByHash(hash, Key);
 	}
 
+	/**
+	* Searches for an element with a key of another type that hashes like KeyType, without constructing a KeyType.
+	* E.g. FStringView for FString keys.
+	* @param Key - The key to search for
+	* @return A pointer to the value associated with the given key, or nullptr if none exists.
+	*/
+	template<typename ComparableKeyType>
+	ValueType* FindAs(const ComparableKeyType& Key)
+	{
+		const uint32 hash = GetTypeHash(Key);
+		return FindByHash(hash, Key);
+	}
+
+	/**
+	* Searches for an element with a key of another type that hashes like KeyType, without constructing a KeyType.
+	* E.g. FStringView for FString keys.
+	* @param Key - The key to search for
+	* @return A pointer to the value associated with the given key, or nullptr if none exists.
+	*/
+	template<typename ComparableKeyType>
+	const ValueType* FindAs(const ComparableKeyType& Key) const
+	{
+		const uint32 hash = GetTypeHash(Key);
+		return FindByHash(hash, Key);
+	}
+
 	/**
 	* Searches for an element with the given key
 	* @param Key - The key to search for
@@ -252,6 +278,18 @@ public:
 		return FindByHash(hash, Key) != nullptr;
 	}
 
+	/**
+	* Checks if the map contains a key of another type that hashes like KeyType, without constructing a KeyType.
+	* @param Key - The key to search for
+	* @return True if the map contains the given key, false otherwise.
+	*/
+	template<typename ComparableKeyType>
+	bool ContainsAs(const ComparableKeyType& Key) const
+	{
+		const uint32 hash = GetTypeHash(Key);
+		return FindByHash(hash, Key) != nullptr;
+	}
+
 	/**
 	* Generates an array from the keys in this map
 	* @param OutKeys - Will hold the generated keys.
@@ -314,8 +352,10 @@ public:
 
 	bool RemoveByHash(uint32 KeyHash, const KeyType& Key) { return m_Set.RemoveByHash(KeyHash); }
 
-	ValueType* FindByHash(uint32 KeyHash, const KeyType& Key);
-	const ValueType* FindByHash(uint32 KeyHash, const KeyType& Key) const;
+	template<typename ComparableKeyType>
+	ValueType* FindByHash(uint32 KeyHash, const ComparableKeyType& Key);
+	template<typename ComparableKeyType>
+	const ValueType* FindByHash(uint32 KeyHash, const ComparableKeyType& Key) const;
 
 private:
 
@@ -419,7 +459,8 @@ inline ValueType& TMap<KeyType, ValueType>::FindOrAddByHash(uint32 KeyHash, KeyT
 }
 
 template<typename KeyType, typename ValueType>
-inline ValueType* TMap<KeyType, ValueType>::FindByHash(uint32 KeyHash, const KeyType& Key)
+template<typename ComparableKeyType>
+inline ValueType* TMap<KeyType, ValueType>::FindByHash(uint32 KeyHash, const ComparableKeyType& Key)
 {
 	auto iterator = m_Set.FindByPredicate([KeyHash](const TPair<KeyType, ValueType>& Pair) -> bool
 		{
@@ -430,7 +471,8 @@ inline ValueType* TMap<KeyType, ValueType>::FindByHash(uint32 KeyHash, const Key
 }
 
 template<typename KeyType, typename ValueType>
-inline const ValueType* TMap<KeyType, ValueType>::FindByHash(uint32 KeyHash, const KeyType& Key) const
+template<typename ComparableKeyType>
+inline const ValueType* TMap<KeyType, ValueType>::FindByHash(uint32 KeyHash, const ComparableKeyType& Key) const
 {
 	auto iterator = m_Set.FindByPredicate([KeyHash](const TPair<KeyType, ValueType>& Pair) -> bool
 		{
@@ -34,6 +34,9 @@ public:
 	*/
 	FString ToString() const;
 
+	// @return View of the name's characters
+	FORCEINLINE FAnsiStringView ToView() const { return FAnsiStringView(m_Name); }
+
 public:
 
 	bool operator==(const ANSICHAR* Other) const;
@@ -107,6 +110,12 @@ public:
 	*/
 	FORCEINLINE FString ToString() const { return m_NameEntry ? m_NameEntry->ToString() : TEXT("None"); }
 
+	/**
+	* Gets the characters of the name without making a string of them.
+	* @return View of the name's characters, valid as long as the name registry.
+	*/
+	FORCEINLINE FAnsiStringView ToAnsiView() const { return !IsNone() ? m_NameEntry->ToView() : FAnsiStringView("None", 4); }
+
 private:
 
 	FNameEntry* m_NameEntry = nullptr;
@@ -119,6 +128,13 @@ public:
 	}
 };
 
+// Lets names be formatted by FString::Format and TStringBuilderWithBuffer::AppendFormat
+template<typename CharType, int32 InlineCapacity>
+inline void AppendFormatArg(TStringBuilderWithBuffer<CharType, InlineCapacity>& Builder, const FName& InName)
+{
+	Builder.AppendAnsi(InName.ToAnsiView());
+}
+
 // Default names
 
 extern CORE_API FName NAME_None;
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "CoreModule.h"
+
+#include "ImpulseString.h"
+#include "Platform/PlatformAtomics.h"
+
+/**
+* Immutable string whose characters live in a reference counted buffer.
+* Copies and substrings share the buffer, so copying costs an atomic increment instead of an allocation and a copy.
+* The reference count is thread-safe and the characters are never modified once the string is made.
+* Only a string made from other characters is null terminated, a substring is not: use GetData together with Length, or ToView.
+*/
+class CORE_API FSharedString
+{
+public:
+
+	FSharedString() = default;
+	FSharedString(const TCHAR* InString);
+	explicit FSharedString(FStringView InString);
+	explicit FSharedString(const FString& InString);
+
+	FORCEINLINE FSharedString(const FSharedString& Other)
+		: m_Buffer(Other.m_Buffer), m_Data(Other.m_Data), m_Length(Other.m_Length)
+	{
+		AddRef();
+	}
+
+	FORCEINLINE FSharedString(FSharedString&& Other) noexcept
+		: m_Buffer(Other.m_Buffer), m_Data(Other.m_Data), m_Length(Other.m_Length)
+	{
+		Other.m_Buffer = nullptr;
+		Other.m_Data = nullptr;
+		Other.m_Length = 0;
+	}
+
+	FORCEINLINE ~FSharedString() { Release(); }
+
+	FSharedString& operator=(const FSharedString& Other);
+	FSharedString& operator=(FSharedString&& Other) noexcept;
+
+	// Compares the characters case sensitive, shared strings and FStrings convert to a view
+	FORCEINLINE bool operator==(FStringView Other) const { return ToView().Equals(Other); }
+	FORCEINLINE bool operator!=(FStringView Other) const { return !ToView().Equals(Other); }
+
+public:
+
+	FORCEINLINE int32 Length() const { return m_Length; }
+	FORCEINLINE bool IsEmpty() const { return m_Length == 0; }
+
+	// @return Pointer to the first character, not null terminated for substrings
+	FORCEINLINE const TCHAR* GetData() const { return m_Data ? m_Data : TEXT(""); }
+
+	FORCEINLINE const TCHAR& operator[](int32 InIndex) const
+	{
+		checkf(InIndex >= 0 && InIndex < m_Length, TEXT("Invalid index."));
+		return m_Data[InIndex];
+	}
+
+	FORCEINLINE FStringView ToView() const { return FStringView(GetData(), m_Length); }
+	FORCEINLINE operator FStringView() const { return ToView(); }
+
+	// @return A copy of the characters that owns its buffer
+	FORCEINLINE FString ToString() const { return FString(ToView()); }
+
+	FORCEINLINE bool Equals(FStringView InOther, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const { return ToView().Equals(InOther, InSearchCase); }
+
+	// Whether other strings share the buffer of this string
+	bool IsShared() const;
+
+public:
+
+	// The substrings share the buffer, see the functions of FStringView with the same name
+
+	FORCEINLINE FSharedString Left(int32 InIndex) const { return SubString(ToView().Left(InIndex)); }
+	FORCEINLINE FSharedString Right(int32 InIndex) const { return SubString(ToView().Right(InIndex)); }
+	FORCEINLINE FSharedString Mid(int32 InStartIndex, int32 InLength) const { return SubString(ToView().Mid(InStartIndex, InLength)); }
+
+	FORCEINLINE FSharedString TrimStart(const TCHAR* InTrimChars = nullptr) const { return SubString(ToView().TrimStart(InTrimChars)); }
+	FORCEINLINE FSharedString TrimEnd(const TCHAR* InTrimChars = nullptr) const { return SubString(ToView().TrimEnd(InTrimChars)); }
+	FORCEINLINE FSharedString Trim(const TCHAR* InTrimChars = nullptr) const { return SubString(ToView().Trim(InTrimChars)); }
+
+private:
+
+	struct FBuffer
+	{
+		volatile FAtomic RefCount;
+
+		/** The null terminated characters, allocated together with the buffer. */
+		TCHAR Chars[1];
+	};
+
+	// Makes a string that shares the buffer, the view must be part of this string
+	FSharedString SubString(FStringView InView) const;
+
+	FORCEINLINE void AddRef() const
+	{
+		if (m_Buffer)
+			FPlatformAtomics::InterlockedIncrement(&m_Buffer->RefCount);
+	}
+
+	FORCEINLINE void Release()
+	{
+		if (m_Buffer && FPlatformAtomics::InterlockedDecrement(&m_Buffer->RefCount) == 0)
+			FMemory::Free(m_Buffer);
+	}
+
+	FBuffer* m_Buffer = nullptr;
+	const TCHAR* m_Data = nullptr;
+	int32 m_Length = 0;
+
+public:
+
+	friend uint32 GetTypeHash(const FSharedString& String)
+	{
+		return GetTypeHash(String.GetData(), String.Length());
+	}
+};
\ No newline at end of file
@@ -0,0 +1,435 @@
+#pragma once
+
+#include "Containers/ImpulseString.h"
+#include "Containers/StringFormat.h"
+#include "Containers/StringView.h"
+
+/**
+* Assembles a string in place, without a temporary string per appended part.
+* The characters are written into an inline buffer of InlineCapacity characters and only move to the heap
+* when the string outgrows it, so strings that fit are built without any allocation.
+* The characters are always null terminated.
+*/
+template<typename CharType, int32 InlineCapacity>
+class TStringBuilderWithBuffer
+{
+	static_assert(InlineCapacity > 0, "The inline buffer needs room for the null terminator.");
+
+	using FPlatformString = TPlatformString<CharType>;
+
+public:
+
+	TStringBuilderWithBuffer()
+	{
+		m_InlineBuffer[0] = 0;
+	}
+
+	explicit TStringBuilderWithBuffer(TStringView<CharType> InView)
+		: TStringBuilderWithBuffer()
+	{
+		Append(InView);
+	}
+
+	TStringBuilderWithBuffer(const TStringBuilderWithBuffer&) = delete;
+	TStringBuilderWithBuffer& operator=(const TStringBuilderWithBuffer&) = delete;
+
+	~TStringBuilderWithBuffer()
+	{
+		if (m_Data != m_InlineBuffer)
+			FMemory::Free(m_Data);
+	}
+
+	// @return The number of characters in the builder
+	FORCEINLINE int32 Length() const { return m_Length; }
+
+	// @return True if no characters were appended
+	FORCEINLINE bool IsEmpty() const { return m_Length == 0; }
+
+	// @return The null terminated characters, valid until the builder is modified
+	FORCEINLINE const CharType* operator*() const { return m_Data; }
+
+	// @return View of the characters, valid until the builder is modified
+	FORCEINLINE TStringView<CharType> ToView() const { return TStringView<CharType>(m_Data, m_Length); }
+	FORCEINLINE operator TStringView<CharType>() const { return ToView(); }
+
+	// @return A string with a copy of the characters
+	FORCEINLINE FString ToString() const { return FString(ToView()); }
+
+	/**
+	* Removes all characters, a heap buffer is kept for reuse.
+	*/
+	FORCEINLINE void Reset()
+	{
+		m_Length = 0;
+		m_Data[0] = 0;
+	}
+
+	/**
+	* Removes characters from the end.
+	* @param InNum - Number of characters to remove.
+	*/
+	FORCEINLINE void RemoveSuffix(int32 InNum)
+	{
+		checkf(InNum >= 0 && InNum <= m_Length, TEXT("Invalid number of characters."));
+
+		m_Length -= InNum;
+		m_Data[m_Length] = 0;
+	}
+
+	TStringBuilderWithBuffer& Append(TStringView<CharType> InView)
+	{
+		EnsureAdditionalCapacity(InView.Length());
+
+		FMemory::Memcpy(m_Data + m_Length, InView.GetData(), static_cast<size_t>(InView.Length()) * sizeof(CharType));
+		m_Length += InView.Length();
+		m_Data[m_Length] = 0;
+
+		return *this;
+	}
+
+	TStringBuilderWithBuffer& AppendChar(CharType InChar)
+	{
+		EnsureAdditionalCapacity(1);
+
+		m_Data[m_Length++] = InChar;
+		m_Data[m_Length] = 0;
+
+		return *this;
+	}
+
+	/**
+	* Appends ANSI characters, each character is widened if the builder has wider characters.
+	*/
+	TStringBuilderWithBuffer& AppendAnsi(FAnsiStringView InView)
+	{
+		if constexpr (std::is_same_v<CharType, ANSICHAR>)
+			return Append(InView);
+
+		EnsureAdditionalCapacity(InView.Length());
+
+		for (const ANSICHAR ansiChar : InView)
+			m_Data[m_Length++] = static_cast<CharType>(static_cast<uint8>(ansiChar));
+
+		m_Data[m_Length] = 0;
+		return *this;
+	}
+
+	/**
+	* Appends the decimal digits of an integer, written directly into the builder.
+	*/
+	template<typename IntType>
+	TStringBuilderWithBuffer& AppendInt(IntType InValue)
+	{
+		static_assert(TIsIntegral<IntType>::Value, "IntType must be an integral type");
+
+		// Magnitude as unsigned, so the minimum value of signed types doesn't overflow
+		uint64 magnitude = static_cast<uint64>(InValue);
+		bool bIsNegative = false;
+
+		if constexpr (TIsSigned<IntType>::Value)
+		{
+			bIsNegative = InValue < 0;
+			if (bIsNegative)
+				magnitude = 0 - magnitude;
+		}
+
+		int32 numDigits = 1;
+		for (uint64 rest = magnitude / 10; rest != 0; rest /= 10)
+			++numDigits;
+
+		EnsureAdditionalCapacity(numDigits + (bIsNegative ? 1 : 0));
+
+		if (bIsNegative)
+			m_Data[m_Length++] = '-';
+
+		// Two digits per division, from the last digit to the first
+
+		static constexpr char digitPairs[] =
+			"0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+			"5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+		CharType* digit = m_Data + m_Length + numDigits;
+
+		while (magnitude >= 100)
+		{
+			const uint64 pair = (magnitude % 100) * 2;
+			magnitude /= 100;
+
+			*--digit = static_cast<CharType>(digitPairs[pair + 1]);
+			*--digit = static_cast<CharType>(digitPairs[pair]);
+		}
+
+		if (magnitude >= 10)
+		{
+			*--digit = static_cast<CharType>(digitPairs[magnitude * 2 + 1]);
+			*--digit = static_cast<CharType>(digitPairs[magnitude * 2]);
+		}
+		else
+		{
+			*--digit = static_cast<CharType>('0' + magnitude);
+		}
+
+		m_Length += numDigits;
+		m_Data[m_Length] = 0;
+
+		return *this;
+	}
+
+	/**
+	* Appends the hexadecimal digits of an integer, negative numbers are written as their two's complement.
+	* @param bUpperCase - Whether the digits A-F are upper case.
+	*/
+	template<typename IntType>
+	TStringBuilderWithBuffer& AppendHex(IntType InValue, bool bUpperCase = false)
+	{
+		static_assert(TIsIntegral<IntType>::Value, "IntType must be an integral type");
+
+		using FUnsignedType = std::make_unsigned_t<IntType>;
+		const char* digits = bUpperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+
+		uint64 value = static_cast<FUnsignedType>(InValue);
+
+		int32 numDigits = 1;
+		for (uint64 rest = value >> 4; rest != 0; rest >>= 4)
+			++numDigits;
+
+		EnsureAdditionalCapacity(numDigits);
+
+		for (CharType* digit = m_Data + m_Length + numDigits; digit != m_Data + m_Length; value >>= 4)
+			*--digit = static_cast<CharType>(digits[value & 0xf]);
+
+		m_Length += numDigits;
+		m_Data[m_Length] = 0;
+
+		return *this;
+	}
+
+	/**
+	* Appends a floating point number, written directly into the builder.
+	* @param MinFractionalDigits - Maximum number of fractional digits, all digits if 0, same as FString::FromFloat.
+	*/
+	template<typename FloatType>
+	TStringBuilderWithBuffer& AppendFloat(FloatType InValue, int32 MinFractionalDigits = 10)
+	{
+		static_assert(TIsFloat<FloatType>::Value, "FloatType must be a floating point type");
+
+		EnsureAdditionalCapacity(FLOAT_STRING_BUFFER_SIZE);
+
+		CharType* dest = m_Data + m_Length;
+
+		if (FPlatformString::template FromFloating<FloatType>(InValue, dest, FLOAT_STRING_BUFFER_SIZE, MinFractionalDigits))
+			m_Length += FPlatformString::Strlen(dest);
+
+		m_Data[m_Length] = 0;
+		return *this;
+	}
+
+	/**
+	* Appends a formatted string, formatted directly into the builder.
+	* @param InFormat - The printf style format string
+	* @param ... - The arguments
+	*/
+	TStringBuilderWithBuffer& Appendf(const CharType* InFormat, ...)
+	{
+		va_list args;
+		va_start(args, InFormat);
+		AppendfV(InFormat, args);
+		va_end(args);
+
+		return *this;
+	}
+
+	/**
+	* Appends a formatted string, formatted directly into the builder.
+	* @param InFormat - The printf style format string
+	* @param InArgs - The arguments, consumed by the call
+	*/
+	TStringBuilderWithBuffer& AppendfV(const CharType* InFormat, va_list InArgs)
+	{
+		// Measure first, formatting must not be truncated and the arguments can only be read once per copy
+
+		va_list argsCopy;
+		va_copy(argsCopy, InArgs);
+		const int32 length = FPlatformString::GetVarArgsLength(InFormat, argsCopy);
+		va_end(argsCopy);
+
+		if (length <= 0)
+			return *this;
+
+		EnsureAdditionalCapacity(length);
+
+		FPlatformString::Vsnprintf(m_Data + m_Length, m_Capacity - m_Length, InFormat, InArgs);
+		m_Length += length;
+		m_Data[m_Length] = 0;
+
+		return *this;
+	}
+
+	/**
+	* Appends a formatted string, each argument is written directly into the builder.
+	* Strings, string views, names, characters, booleans and numbers can be formatted, other types by an
+	* AppendFormatArg(TStringBuilderWithBuffer&, const T&) overload found by argument dependent lookup.
+	* @param InFormat - The format string, validated against the arguments at compile time, see TFormatString
+	* @param InArgs - The arguments
+	*/
+	template<typename... ArgTypes>
+	TStringBuilderWithBuffer& AppendFormat(TFormatString<CharType, typename TIdentity<ArgTypes>::Type...> InFormat, const ArgTypes&... InArgs)
+	{
+		// Type erased, so the formatting loop is compiled once and not for every combination of argument types
+		const FFormatArg args[] = { FFormatArg{ &InArgs, &AppendFormatArgThunk<ArgTypes> }..., FFormatArg{} };
+
+		AppendFormatArgs(InFormat.GetView(), args);
+		return *this;
+	}
+
+	FORCEINLINE TStringBuilderWithBuffer& operator+=(TStringView<CharType> InView) { return Append(InView); }
+	FORCEINLINE TStringBuilderWithBuffer& operator+=(CharType InChar) { return AppendChar(InChar); }
+
+private:
+
+	struct FFormatArg
+	{
+		const void* Value = nullptr;
+		void (*Append)(TStringBuilderWithBuffer&, const void*, const FFormatSpec&) = nullptr;
+	};
+
+	template<typename ArgType>
+	static void AppendFormatArgThunk(TStringBuilderWithBuffer& Builder, const void* InValue, const FFormatSpec& InSpec)
+	{
+		Builder.AppendFormatArgValue(*static_cast<const ArgType*>(InValue), InSpec);
+	}
+
+	template<typename ArgType>
+	void AppendFormatArgValue(const ArgType& InValue, const FFormatSpec& InSpec)
+	{
+		if constexpr (std::is_same_v<ArgType, bool>)
+			AppendAnsi(InValue ? "true" : "false");
+		else if constexpr (TIsCharType<ArgType>::Value)
+			AppendChar(static_cast<CharType>(InValue));
+		else if constexpr (TIsIntegral<ArgType>::Value)
+			InSpec.bHex ? AppendHex(InValue, InSpec.bUpperCase) : AppendInt(InValue);
+		else if constexpr (TIsFloat<ArgType>::Value)
+			InSpec.Precision > 0 ? AppendFloat(InValue, InSpec.Precision) : AppendFloat(InValue);
+		else if constexpr (std::is_convertible_v<const ArgType&, TStringView<CharType>>)
+			Append(TStringView<CharType>(InValue));
+		else if constexpr (std::is_convertible_v<const ArgType&, FAnsiStringView>)
+			AppendAnsi(FAnsiStringView(InValue));
+		else
+			AppendFormatArg(*this, InValue);
+	}
+
+	// The format string was validated at compile time, so it's parsed here without checking for errors
+	void AppendFormatArgs(TStringView<CharType> InFormat, const FFormatArg* InArgs)
+	{
+		const CharType* format = InFormat.GetData();
+		const int32 formatLength = InFormat.Length();
+
+		IE::Private::Format::FArgIndexing indexing;
+
+		for (int32 i = 0; i < formatLength;)
+		{
+			// Literal text up to the next brace
+
+			int32 literalEnd = i;
+			while (literalEnd < formatLength && format[literalEnd] != '{' && format[literalEnd] != '}')
+				++literalEnd;
+
+			Append(TStringView<CharType>(format + i, literalEnd - i));
+			i = literalEnd;
+
+			if (i >= formatLength)
+				break;
+
+			if (i + 1 < formatLength && format[i + 1] == format[i])
+			{
+				AppendChar(format[i]);
+				i += 2;
+				continue;
+			}
+
+			int32 argIndex = 0;
+			FFormatSpec spec;
+			IE::Private::Format::ParsePlaceholder(format, formatLength, i, indexing, argIndex, spec);
+
+			const int32 argStart = m_Length;
+			InArgs[argIndex].Append(*this, InArgs[argIndex].Value, spec);
+
+			if (m_Length - argStart < spec.Width)
+				PadFormatArg(argStart, spec);
+		}
+	}
+
+	// Pads the argument written from InArgStart to the width of the spec
+	void PadFormatArg(int32 InArgStart, const FFormatSpec& InSpec)
+	{
+		const int32 padding = InSpec.Width - (m_Length - InArgStart);
+		EnsureAdditionalCapacity(padding);
+
+		int32 paddingStart = m_Length;
+
+		if (!InSpec.bLeftAlign)
+		{
+			// Zeros go between the sign and the digits
+			paddingStart = InArgStart;
+			if (InSpec.bZeroPad && m_Length > InArgStart && m_Data[InArgStart] == '-')
+				++paddingStart;
+
+			FMemory::Memmove(m_Data + paddingStart + padding, m_Data + paddingStart, static_cast<size_t>(m_Length - paddingStart) * sizeof(CharType));
+		}
+
+		const CharType paddingChar = InSpec.bZeroPad ? '0' : ' ';
+		for (int32 i = 0; i < padding; ++i)
+			m_Data[paddingStart + i] = paddingChar;
+
+		m_Length += padding;
+		m_Data[m_Length] = 0;
+	}
+
+	// Makes room for InNum more characters and the null terminator
+	void EnsureAdditionalCapacity(int32 InNum)
+	{
+		checkf(InNum >= 0 && InNum < MAX_int32 - m_Length - 1, TEXT("String builder is too long."));
+
+		const int32 requiredCapacity = m_Length + InNum + 1;
+		if (requiredCapacity <= m_Capacity)
+			return;
+
+		// Grow geometrically, so appending many small parts copies the characters only a few times
+		const int32 newCapacity = FMath::Max(requiredCapacity, m_Capacity > MAX_int32 / 2 ? MAX_int32 : m_Capacity * 2);
+
+		if (m_Data == m_InlineBuffer)
+		{
+			m_Data = static_cast<CharType*>(FMemory::Malloc(static_cast<size_t>(newCapacity) * sizeof(CharType)));
+			FMemory::Memcpy(m_Data, m_InlineBuffer, static_cast<size_t>(m_Length + 1) * sizeof(CharType));
+		}
+		else
+		{
+			m_Data = static_cast<CharType*>(FMemory::Realloc(m_Data, static_cast<size_t>(newCapacity) * sizeof(CharType)));
+		}
+
+		m_Capacity = newCapacity;
+	}
+
+private:
+
+	CharType m_InlineBuffer[InlineCapacity];
+
+	CharType* m_Data = m_InlineBuffer;
+	int32 m_Length = 0;
+	int32 m_Capacity = InlineCapacity;
+};
+
+template<int32 InlineCapacity>
+using TStringBuilder = TStringBuilderWithBuffer<TCHAR, InlineCapacity>;
+
+template<int32 InlineCapacity>
+using TAnsiStringBuilder = TStringBuilderWithBuffer<ANSICHAR, InlineCapacity>;
+
+template<typename... ArgTypes>
+FString FString::Format(TFormatString<TCHAR, typename TIdentity<ArgTypes>::Type...> InFormat, const ArgTypes&... InArgs)
+{
+	TStringBuilder<STRING_PRINTF_BUFFER_SIZE> builder;
+	builder.AppendFormat(InFormat, InArgs...);
+
+	return builder.ToString();
+}
\ No newline at end of file
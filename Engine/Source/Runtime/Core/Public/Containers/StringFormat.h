@@ -0,0 +1,273 @@
+#pragma once
+
+#include "Containers/StringView.h"
+
+#include "Templates/ImpulseTemplates.h"
+#include "Templates/TypeTraits.h"
+
+// Max argument index, width and precision of a placeholder, keeps malformed specs from reserving huge buffers
+#define IE_FORMAT_MAX_WIDTH 1024
+
+/**
+* Options of a placeholder, parsed from the part after the colon: {Index:[-|0][Width][.Precision][x|X]}
+*/
+struct FFormatSpec
+{
+	// Minimum number of characters, padded with spaces on the left unless left aligned or zero padded
+	int32 Width = 0;
+
+	// Maximum number of fractional digits of floating point numbers, 0 for the default
+	int32 Precision = 0;
+
+	bool bLeftAlign = false;
+	bool bZeroPad = false;
+	bool bHex = false;
+	bool bUpperCase = false;
+};
+
+// Kind of a format argument, decides which parts of a placeholder spec can be used with it
+enum class EFormatArgType : uint8
+{
+	Integer,
+	Float,
+	Other
+};
+
+enum class EFormatError : uint8
+{
+	None,
+	UnmatchedBrace,
+	InvalidPlaceholder,
+	MixedArgIndexing,
+	ArgIndexOutOfRange,
+	InvalidSpec,
+	SpecNotSupportedByArgType
+};
+
+namespace IE::Private::Format
+{
+	template<typename T>
+	constexpr EFormatArgType GetArgType()
+	{
+		if constexpr (TIsCharType<T>::Value || std::is_same_v<T, bool>)
+			return EFormatArgType::Other;
+		else if constexpr (TIsIntegral<T>::Value)
+			return EFormatArgType::Integer;
+		else if constexpr (TIsFloat<T>::Value)
+			return EFormatArgType::Float;
+		else
+			return EFormatArgType::Other;
+	}
+
+	template<typename CharType>
+	constexpr bool IsDigit(CharType InChar)
+	{
+		return InChar >= '0' && InChar <= '9';
+	}
+
+	// Argument indexing of a format string, automatic ({}) and manual ({0}) indices can't be mixed
+	struct FArgIndexing
+	{
+		int32 NextArgIndex = 0;
+		bool bAutomatic = false;
+		bool bManual = false;
+	};
+
+	/**
+	* Parses a number of a placeholder.
+	* @return False if the number is larger than IE_FORMAT_MAX_WIDTH.
+	*/
+	template<typename CharType>
+	constexpr bool ParseNumber(const CharType* InFormat, int32 InLength, int32& InOutIndex, int32& OutValue)
+	{
+		OutValue = 0;
+
+		for (; InOutIndex < InLength && IsDigit(InFormat[InOutIndex]); ++InOutIndex)
+		{
+			OutValue = OutValue * 10 + (InFormat[InOutIndex] - '0');
+			if (OutValue > IE_FORMAT_MAX_WIDTH)
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	* Parses a placeholder, used both to validate format strings at compile time and to format them at runtime.
+	* @param InOutIndex - Index of the opening brace, moved past the closing brace.
+	* @param InOutIndexing - Indexing state of the previous placeholders.
+	* @param OutArgIndex - Index of the argument the placeholder refers to.
+	* @param OutSpec - Options of the placeholder.
+	*/
+	template<typename CharType>
+	constexpr EFormatError ParsePlaceholder(const CharType* InFormat, int32 InLength, int32& InOutIndex, FArgIndexing& InOutIndexing, int32& OutArgIndex, FFormatSpec& OutSpec)
+	{
+		int32 i = InOutIndex + 1;
+
+		if (i < InLength && IsDigit(InFormat[i]))
+		{
+			if (!ParseNumber(InFormat, InLength, i, OutArgIndex))
+				return EFormatError::ArgIndexOutOfRange;
+
+			InOutIndexing.bManual = true;
+		}
+		else
+		{
+			OutArgIndex = InOutIndexing.NextArgIndex++;
+			InOutIndexing.bAutomatic = true;
+		}
+
+		if (InOutIndexing.bAutomatic && InOutIndexing.bManual)
+			return EFormatError::MixedArgIndexing;
+
+		OutSpec = FFormatSpec();
+
+		if (i < InLength && InFormat[i] == ':')
+		{
+			++i;
+
+			if (i < InLength && InFormat[i] == '-')
+			{
+				OutSpec.bLeftAlign = true;
+				++i;
+			}
+			else if (i < InLength && InFormat[i] == '0')
+			{
+				OutSpec.bZeroPad = true;
+				++i;
+			}
+
+			if (!ParseNumber(InFormat, InLength, i, OutSpec.Width))
+				return EFormatError::InvalidSpec;
+
+			if (i < InLength && InFormat[i] == '.')
+			{
+				++i;
+
+				if (i >= InLength || !IsDigit(InFormat[i]) || !ParseNumber(InFormat, InLength, i, OutSpec.Precision) || OutSpec.Precision == 0)
+					return EFormatError::InvalidSpec;
+			}
+
+			if (i < InLength && (InFormat[i] == 'x' || InFormat[i] == 'X'))
+			{
+				OutSpec.bHex = true;
+				OutSpec.bUpperCase = InFormat[i] == 'X';
+				++i;
+			}
+		}
+
+		if (i >= InLength)
+			return EFormatError::UnmatchedBrace;
+		if (InFormat[i] != '}')
+			return EFormatError::InvalidPlaceholder;
+
+		InOutIndex = i + 1;
+		return EFormatError::None;
+	}
+
+	/**
+	* Validates a format string against the types of its arguments.
+	* @return The first error in the format string.
+	*/
+	template<typename CharType>
+	constexpr EFormatError Validate(const CharType* InFormat, int32 InLength, const EFormatArgType* InArgTypes, int32 InNumArgs)
+	{
+		FArgIndexing indexing;
+
+		for (int32 i = 0; i < InLength;)
+		{
+			if (InFormat[i] == '}')
+			{
+				if (i + 1 >= InLength || InFormat[i + 1] != '}')
+					return EFormatError::UnmatchedBrace;
+
+				i += 2;
+			}
+			else if (InFormat[i] == '{')
+			{
+				if (i + 1 < InLength && InFormat[i + 1] == '{')
+				{
+					i += 2;
+					continue;
+				}
+
+				int32 argIndex = 0;
+				FFormatSpec spec;
+
+				const EFormatError error = ParsePlaceholder(InFormat, InLength, i, indexing, argIndex, spec);
+				if (error != EFormatError::None)
+					return error;
+
+				if (argIndex >= InNumArgs)
+					return EFormatError::ArgIndexOutOfRange;
+
+				const EFormatArgType argType = InArgTypes[argIndex];
+
+				if ((spec.bHex && argType != EFormatArgType::Integer)
+					|| (spec.Precision > 0 && argType != EFormatArgType::Float)
+					|| (spec.bZeroPad && argType == EFormatArgType::Other))
+				{
+					return EFormatError::SpecNotSupportedByArgType;
+				}
+			}
+			else
+			{
+				++i;
+			}
+		}
+
+		return EFormatError::None;
+	}
+
+	// Not constexpr, so calling them while validating a format string at compile time fails the compilation
+	// with the name of the error in the diagnostic
+
+	inline void FormatError_UnmatchedBrace() {}
+	inline void FormatError_InvalidPlaceholder() {}
+	inline void FormatError_MixedAutomaticAndManualArgIndices() {}
+	inline void FormatError_ArgIndexOutOfRange() {}
+	inline void FormatError_InvalidSpec() {}
+	inline void FormatError_SpecNotSupportedByArgType() {}
+}
+
+/**
+* Format string of FString::Format and TStringBuilderWithBuffer::AppendFormat, validated against the argument types at compile time.
+* Placeholders are {} for the next argument or {Index} for a specific one, optionally followed by a spec: {Index:[-|0][Width][.Precision][x|X]}.
+* - '-' left aligns and '0' pads numbers with zeros, Width is the minimum number of characters.
+* - Precision is the maximum number of fractional digits of floating point numbers.
+* - 'x' and 'X' write integers as lower or upper case hexadecimal.
+* Braces are written with {{ and }}.
+*/
+template<typename CharType, typename... ArgTypes>
+class TFormatString
+{
+public:
+
+	template<int32 N>
+	consteval TFormatString(const CharType (&InFormat)[N])
+		: m_Format(InFormat, N - 1)
+	{
+		using namespace IE::Private::Format;
+
+		// Trailing element, so there's no empty array without arguments
+		constexpr EFormatArgType argTypes[] = { GetArgType<ArgTypes>()..., EFormatArgType::Other };
+
+		switch (Validate(InFormat, N - 1, argTypes, static_cast<int32>(sizeof...(ArgTypes))))
+		{
+		case EFormatError::UnmatchedBrace:				FormatError_UnmatchedBrace(); break;
+		case EFormatError::InvalidPlaceholder:			FormatError_InvalidPlaceholder(); break;
+		case EFormatError::MixedArgIndexing:			FormatError_MixedAutomaticAndManualArgIndices(); break;
+		case EFormatError::ArgIndexOutOfRange:			FormatError_ArgIndexOutOfRange(); break;
+		case EFormatError::InvalidSpec:					FormatError_InvalidSpec(); break;
+		case EFormatError::SpecNotSupportedByArgType:	FormatError_SpecNotSupportedByArgType(); break;
+		default: break;
+		}
+	}
+
+	// @return The format string
+	FORCEINLINE TStringView<CharType> GetView() const { return m_Format; }
+
+private:
+
+	TStringView<CharType> m_Format;
+};
\ No newline at end of file
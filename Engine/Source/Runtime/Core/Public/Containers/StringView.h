@@ -0,0 +1,293 @@
+#pragma once
+
+#include "Platform/PlatformString.h"
+
+#include "Misc/Char.h"
+#include "Text/CaseFolding.h"
+
+enum class ESearchDir : uint8
+{
+	FromStart,
+	FromEnd
+};
+
+/**
+* Non-owning view of a range of characters, the characters have to outlive the view.
+* The range isn't necessarily null terminated, always use the length.
+* None of the operations allocate, substrings and trimmed strings are views of the same characters.
+*/
+template<typename CharType>
+class TStringView
+{
+	using FPlatformString = TPlatformString<CharType>;
+
+public:
+
+	constexpr TStringView() = default;
+
+	constexpr TStringView(const CharType* InData, int32 InLength)
+		: m_Data(InData)
+		, m_Length(InLength) {}
+
+	TStringView(const CharType* InData)
+		: m_Data(InData)
+		, m_Length(InData ? FPlatformString::Strlen(InData) : 0) {}
+
+	// @return The number of characters in the view
+	FORCEINLINE int32 Length() const { return m_Length; }
+
+	// @return Pointer to the first character, not necessarily null terminated
+	FORCEINLINE const CharType* GetData() const { return m_Data; }
+
+	// @return True if the view has no characters
+	FORCEINLINE bool IsEmpty() const { return m_Length == 0; }
+
+	FORCEINLINE const CharType& operator[](int32 InIndex) const
+	{
+		checkf(InIndex >= 0 && InIndex < m_Length, TEXT("Invalid index."));
+		return m_Data[InIndex];
+	}
+
+	FORCEINLINE const CharType* begin() const { return m_Data; }
+	FORCEINLINE const CharType* end() const { return m_Data + m_Length; }
+
+	// @param InIndex - Index where the substring should end
+	// @return The characters on the left side of the specified index (Index not included)
+	FORCEINLINE TStringView Left(int32 InIndex) const
+	{
+		checkf(InIndex >= 0 && InIndex <= m_Length, TEXT("Invalid index."));
+		return TStringView(m_Data, InIndex);
+	}
+
+	// @param InIndex - Index where the substring should start
+	// @return The characters on the right side of the specified index (Index not included)
+	FORCEINLINE TStringView Right(int32 InIndex) const
+	{
+		checkf(InIndex >= 0 && InIndex < m_Length, TEXT("Invalid index."));
+		return TStringView(m_Data + InIndex + 1, m_Length - InIndex - 1);
+	}
+
+	// @param InStartIndex - Index where the substring should start
+	// @param InLength - The number of characters to include in the substring
+	// @return The characters in the specified range
+	FORCEINLINE TStringView Mid(int32 InStartIndex, int32 InLength) const
+	{
+		checkf(InStartIndex >= 0 && InStartIndex <= m_Length, TEXT("Invalid start index."));
+		checkf(InLength >= 0 && InLength <= m_Length - InStartIndex, TEXT("Invalid length."));
+
+		return TStringView(m_Data + InStartIndex, InLength);
+	}
+
+	// Finds the first occurrence of the specified substring
+	// @param InSubStr - The substring to search for
+	// @param InSearchCase - Whether or not the search should be case sensitive
+	// @param InSearchDir - The direction to search in
+	// @param InStartIndex - Number of characters to skip, from the start or the end depending on the direction
+	// @return The index of the occurrence or -1 if not found
+	int32 Find(TStringView InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive, ESearchDir InSearchDir = ESearchDir::FromStart, int32 InStartIndex = 0) const
+	{
+		InStartIndex = FMath::Max(InStartIndex, 0);
+
+		if (InSubStr.m_Length == 0 || InSubStr.m_Length > m_Length - InStartIndex)
+			return INDEX_NONE;
+
+		if (InSearchDir == ESearchDir::FromStart)
+		{
+			const TStringView searched(m_Data + InStartIndex, m_Length - InStartIndex);
+			const int32 index = InSearchCase == ESearchCase::CaseSensitive
+				? FStringSearch::Find(searched.m_Data, searched.m_Length, InSubStr.m_Data, InSubStr.m_Length)
+				: searched.FindIgnoreCase(InSubStr);
+
+			return index != INDEX_NONE ? index + InStartIndex : INDEX_NONE;
+		}
+
+		const TStringView searched(m_Data, m_Length - InStartIndex);
+		return InSearchCase == ESearchCase::CaseSensitive
+			? FStringSearch::FindLast(searched.m_Data, searched.m_Length, InSubStr.m_Data, InSubStr.m_Length)
+			: searched.FindLastIgnoreCase(InSubStr);
+	}
+
+	// @return The index of the first occurrence of the character or -1 if not found
+	FORCEINLINE int32 FindChar(CharType InChar) const
+	{
+		return FStringSearch::FindChar(m_Data, m_Length, InChar);
+	}
+
+	// @return The index of the last occurrence of the character or -1 if not found
+	FORCEINLINE int32 FindLastChar(CharType InChar) const
+	{
+		return FStringSearch::FindLastChar(m_Data, m_Length, InChar);
+	}
+
+	// @return True if the view contains the specified substring
+	FORCEINLINE bool Contains(TStringView InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const
+	{
+		return Find(InSubStr, InSearchCase) != INDEX_NONE;
+	}
+
+	// @return True if the view contains the specified character
+	FORCEINLINE bool ContainsChar(CharType InChar) const
+	{
+		return FindChar(InChar) != INDEX_NONE;
+	}
+
+	// @return True if the view starts with the specified substring
+	FORCEINLINE bool StartsWith(TStringView InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const
+	{
+		return InSubStr.m_Length <= m_Length && FPlatformString::Compare(m_Data, InSubStr.m_Data, InSubStr.m_Length, InSearchCase);
+	}
+
+	// @return True if the view ends with the specified substring
+	FORCEINLINE bool EndsWith(TStringView InSubStr, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const
+	{
+		return InSubStr.m_Length <= m_Length && FPlatformString::Compare(m_Data + (m_Length - InSubStr.m_Length), InSubStr.m_Data, InSubStr.m_Length, InSearchCase);
+	}
+
+	// @return True if both views have the same characters
+	FORCEINLINE bool Equals(TStringView InOther, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const
+	{
+		return m_Length == InOther.m_Length && FPlatformString::Compare(m_Data, InOther.m_Data, m_Length, InSearchCase);
+	}
+
+	// Compares the views character by character, a view that is a prefix of the other sorts first
+	// @return Negative if this view sorts before the other, positive if it sorts after it, 0 if they are equal
+	int32 Compare(TStringView InOther, ESearchCase InSearchCase = ESearchCase::CaseSensitive) const
+	{
+		const int32 minLength = FMath::Min(m_Length, InOther.m_Length);
+
+		for (int32 i = 0; i < minLength; ++i)
+		{
+			const CharType a = InSearchCase == ESearchCase::IgnoreCase ? FCaseFolding::Fold(m_Data[i]) : m_Data[i];
+			const CharType b = InSearchCase == ESearchCase::IgnoreCase ? FCaseFolding::Fold(InOther.m_Data[i]) : InOther.m_Data[i];
+
+			if (a != b)
+				return a < b ? -1 : 1;
+		}
+
+		return m_Length - InOther.m_Length;
+	}
+
+	// @param InTrimChars - The characters to trim, null terminated, white-space if null
+	// @return The view without the specified characters at the beginning
+	TStringView TrimStart(const CharType* InTrimChars = nullptr) const
+	{
+		const TStringView trimChars = InTrimChars ? TStringView(InTrimChars) : GetDefaultTrimChars();
+
+		const int32 start = FStringSearch::FindFirstNotOf(m_Data, m_Length, trimChars.m_Data, trimChars.m_Length);
+		return start != INDEX_NONE ? TStringView(m_Data + start, m_Length - start) : TStringView(m_Data + m_Length, 0);
+	}
+
+	// @param InTrimChars - The characters to trim, null terminated, white-space if null
+	// @return The view without the specified characters at the end
+	TStringView TrimEnd(const CharType* InTrimChars = nullptr) const
+	{
+		const TStringView trimChars = InTrimChars ? TStringView(InTrimChars) : GetDefaultTrimChars();
+
+		const int32 last = FStringSearch::FindLastNotOf(m_Data, m_Length, trimChars.m_Data, trimChars.m_Length);
+		return TStringView(m_Data, last + 1);
+	}
+
+	// @param InTrimChars - The characters to trim, null terminated, white-space if null
+	// @return The view without the specified characters at the beginning and end
+	FORCEINLINE TStringView Trim(const CharType* InTrimChars = nullptr) const
+	{
+		return TrimStart(InTrimChars).TrimEnd(InTrimChars);
+	}
+
+	/**
+	* Converts the view to a number.
+	* @param OutValue - The number, unchanged if the conversion fails.
+	* @return True if the conversion was successful, false otherwise.
+	*/
+	template<typename NumType>
+	bool ToNumber(NumType& OutValue) const
+	{
+		if constexpr (TIsFloat<NumType>::Value)
+			return FPlatformString::template ToFloating<NumType>(m_Data, m_Length, OutValue);
+		else
+			return FPlatformString::template ToIntegral<NumType>(m_Data, m_Length, OutValue);
+	}
+
+	/**
+	* Converts the view to a boolean, accepts "1", "0", "true" and "false".
+	* @param OutValue - The boolean, unchanged if the conversion fails.
+	* @return True if the conversion was successful, false otherwise.
+	*/
+	FORCEINLINE bool ToBool(bool& OutValue) const
+	{
+		return FPlatformString::ToBool(m_Data, m_Length, OutValue);
+	}
+
+	FORCEINLINE bool operator==(TStringView InOther) const { return Equals(InOther); }
+	FORCEINLINE bool operator!=(TStringView InOther) const { return !Equals(InOther); }
+
+private:
+
+	// White-space, same as FString::DefaultTrimChars
+	static TStringView GetDefaultTrimChars()
+	{
+		static constexpr CharType defaultTrimChars[] = { ' ', '\t', '\r', '\n', '\v', '\f' };
+		return TStringView(defaultTrimChars, 6);
+	}
+
+	// Only positions that start with a case variant of the first character are compared,
+	// every position is compared if the first character isn't ASCII and its variants aren't known
+	int32 FindIgnoreCase(TStringView InSubStr) const
+	{
+		CharType firstChars[3];
+		const int32 numFirstChars = FCaseFolding::GetCaseVariants(InSubStr.m_Data[0], firstChars);
+		const int32 lastIndex = m_Length - InSubStr.m_Length;
+
+		for (int32 i = 0; i <= lastIndex; ++i)
+		{
+			if (numFirstChars > 0)
+			{
+				const int32 found = FStringSearch::FindFirstOf(m_Data + i, lastIndex + 1 - i, firstChars, numFirstChars);
+				if (found == INDEX_NONE)
+					break;
+
+				i += found;
+			}
+
+			if (FPlatformString::Compare(m_Data + i, InSubStr.m_Data, InSubStr.m_Length, ESearchCase::IgnoreCase))
+				return i;
+		}
+
+		return INDEX_NONE;
+	}
+
+	int32 FindLastIgnoreCase(TStringView InSubStr) const
+	{
+		CharType firstChars[3];
+		const int32 numFirstChars = FCaseFolding::GetCaseVariants(InSubStr.m_Data[0], firstChars);
+
+		for (int32 end = m_Length - InSubStr.m_Length + 1; end > 0;)
+		{
+			const int32 found = numFirstChars > 0 ? FStringSearch::FindLastOf(m_Data, end, firstChars, numFirstChars) : end - 1;
+			if (found == INDEX_NONE)
+				break;
+
+			if (FPlatformString::Compare(m_Data + found, InSubStr.m_Data, InSubStr.m_Length, ESearchCase::IgnoreCase))
+				return found;
+
+			end = found;
+		}
+
+		return INDEX_NONE;
+	}
+
+private:
+
+	const CharType* m_Data = nullptr;
+	int32 m_Length = 0;
+};
+
+typedef TStringView<TCHAR> FStringView;
+typedef TStringView<ANSICHAR> FAnsiStringView;
+
+// Case insensitive, same as the hash of an FString with the same characters
+template<typename CharType>
+inline uint32 GetTypeHash(TStringView<CharType> InView)
+{
+	return GetTypeHash(InView.GetData(), InView.Length());
+}
\ No newline at end of file
@@ -4,9 +4,11 @@
 
 #include "Containers/ImpulseString.h"
 
+#include "Templates/TypeCompatibleBytes.h"
+
 namespace EVariantType
 {
-	enum Type
+	enum Type : uint8
 	{
 		Unknown,
 		Bool,
@@ -21,163 +23,43 @@ namespace EVariantType
 		Float,
 		Double,
 		String,
+
+		Count
 	};
 }
 
-class CORE_API IVariantData
-{
-public:
-
-	virtual void Serialize(FArchive& Ar) = 0;
-	virtual IVariantData* MakeCopy() = 0;
-};
-
-/**
-* Variant for data that is stored on the stack.
-*/
-template<typename T>
-class CORE_API FStackVariantData : public IVariantData
-{
-public:
-
-	FStackVariantData(const T& InData)
-	{
-		FMemory::Memcpy(&Data, &InData, sizeof(T));
-	}
-
-	virtual void Serialize(FArchive& Ar) override
-	{
-		Ar.Serialize(&Data, sizeof(T));
-	}
-
-	virtual IVariantData* MakeCopy() override
-	{
-		return new FStackVariantData<T>(*((T*)Data.Bytes));
-	}
-
-	TTypeCompatibleBytesPtr<T> Data;
-};
-
-/**
-* Variant data for strings.
-*/
-class CORE_API FStringVariantData : public IVariantData
-{
-public:
-
-	FStringVariantData(const FString& InData)
-		: Data(InData)
-	{
-	}
-
-	virtual void Serialize(FArchive& Ar) override
-	{
-		Ar << Data;
-	}
-
-	virtual IVariantData* MakeCopy() override
-	{
-		return new FStringVariantData(Data);
-	}
-
-	FString Data;
-};
-
 template<typename T>
 struct TVariantType
 {
 	static_assert(sizeof(T) == 0, "Unsupported type");
 };
 
-template<>
-struct TVariantType<bool>
-{
-	static constexpr EVariantType::Type Type = EVariantType::Bool;
-	typedef FStackVariantData<bool> TData;
-};
-
-template<>
-struct TVariantType<int8>
-{
-	static constexpr EVariantType::Type Type = EVariantType::Int8;
-	typedef FStackVariantData<int8> TData;
-};
-
-template<>
-struct TVariantType<int16>
-{
-	static constexpr EVariantType::Type Type = EVariantType::Int16;
-	typedef FStackVariantData<int16> TData;
-};
-
-template<>
-struct TVariantType<int32>
-{
-	static constexpr EVariantType::Type Type = EVariantType::Int32;
-	typedef FStackVariantData<int32> TData;
-};
-
-template<>
-struct TVariantType<int64>
-{
-	static constexpr EVariantType::Type Type = EVariantType::Int64;
-	typedef FStackVariantData<int64> TData;
-};
-
-template<>
-struct TVariantType<uint8>
-{
-	static constexpr EVariantType::Type Type = EVariantType::UInt8;
-	typedef FStackVariantData<uint8> TData;
-};
-
-template<>
-struct TVariantType<uint16>
-{
-	static constexpr EVariantType::Type Type = EVariantType::UInt16;
-	typedef FStackVariantData<uint16> TData;
-};
-
-template<>
-struct TVariantType<uint32>
-{
-	static constexpr EVariantType::Type Type = EVariantType::UInt32;
-	typedef FStackVariantData<uint32> TData;
-};
-
-template<>
-struct TVariantType<uint64>
-{
-	static constexpr EVariantType::Type Type = EVariantType::UInt64;
-	typedef FStackVariantData<uint64> TData;
-};
-
-template<>
-struct TVariantType<float>
-{
-	static constexpr EVariantType::Type Type = EVariantType::Float;
-	typedef FStackVariantData<float> TData;
-};
-
-template<>
-struct TVariantType<double>
-{
-	static constexpr EVariantType::Type Type = EVariantType::Double;
-	typedef FStackVariantData<double> TData;
-};
-
-template<>
-struct TVariantType<FString>
-{
-	static constexpr EVariantType::Type Type = EVariantType::String;
-	typedef FStringVariantData TData;
-};
+template<> struct TVariantType<bool> { static constexpr EVariantType::Type Type = EVariantType::Bool; };
+template<> struct TVariantType<int8> { static constexpr EVariantType::Type Type = EVariantType::Int8; };
+template<> struct TVariantType<int16> { static constexpr EVariantType::Type Type = EVariantType::Int16; };
+template<> struct TVariantType<int32> { static constexpr EVariantType::Type Type = EVariantType::Int32; };
+template<> struct TVariantType<int64> { static constexpr EVariantType::Type Type = EVariantType::Int64; };
+template<> struct TVariantType<uint8> { static constexpr EVariantType::Type Type = EVariantType::UInt8; };
+template<> struct TVariantType<uint16> { static constexpr EVariantType::Type Type = EVariantType::UInt16; };
+template<> struct TVariantType<uint32> { static constexpr EVariantType::Type Type = EVariantType::UInt32; };
+template<> struct TVariantType<uint64> { static constexpr EVariantType::Type Type = EVariantType::UInt64; };
+template<> struct TVariantType<float> { static constexpr EVariantType::Type Type = EVariantType::Float; };
+template<> struct TVariantType<double> { static constexpr EVariantType::Type Type = EVariantType::Double; };
+template<> struct TVariantType<FString> { static constexpr EVariantType::Type Type = EVariantType::String; };
 
 /**
 * Variant that can hold any type of data.
+*
+* All values are stored inline: Scalars live in a union, short strings are stored as characters
+* in the same union and only longer strings use an FString.
 */
 class CORE_API FVariant
 {
+public:
+
+	/** Maximum number of characters of a string that is stored without allocating, excluding the null terminator. */
+	static constexpr int32 InlineStringCapacity = static_cast<int32>(sizeof(FString) / sizeof(TCHAR)) - 1;
+
 public:
 
 	FVariant() = default;
@@ -187,6 +69,8 @@ public:
 	template<typename T>
 	FVariant(const T& InData);
 
+	FVariant(const TCHAR* InString);
+
 	~FVariant();
 
 	FVariant& operator=(const FVariant& Other);
@@ -195,57 +79,133 @@ public:
 	template<typename T>
 	FVariant& operator=(const T& InData);
 
+	FVariant& operator=(const TCHAR* InString);
+
+	/**
+	* Gets the value of the variant.
+	* The variant has to hold a value of the requested type.
+	* @return A copy of the value.
+	*/
 	template<typename T>
-	T& GetValue();
-	template<typename T>
-	const T& GetValue() const;
+	T GetValue() const;
+
+	/**
+	* Gets the characters of a string variant without copying them.
+	* @return The null terminated characters of the string.
+	*/
+	const TCHAR* GetString() const;
+
+	/**
+	* Gets the length of a string variant.
+	* @return The number of characters in the string.
+	*/
+	int32 GetStringLength() const;
+
+	/**
+	* Resets the variant to an empty value of unknown type.
+	*/
+	void Empty();
 
 	FORCEINLINE EVariantType::Type GetType() const { return Type; }
+	FORCEINLINE bool IsEmpty() const { return Type == EVariantType::Unknown; }
+
+public:
+
+	/**
+	* Serializes the variant as a one byte type tag followed by the value.
+	* Strings are written like an FString. Loading sets an error on an unknown type tag or an invalid string.
+	*/
+	friend CORE_API FArchive& operator<<(FArchive& Ar, FVariant& Variant);
+
+private:
+
+	void SetString(const TCHAR* InString, int32 InLength);
+
+	/**
+	* Makes the variant hold an uninitialized string of the given length.
+	* @return The buffer for the characters, already null terminated.
+	*/
+	TCHAR* InitString(int32 InLength);
+	void CopyFrom(const FVariant& Other);
+	void MoveFrom(FVariant& Other);
+
+	FORCEINLINE FString& GetHeapString() { return *reinterpret_cast<FString*>(Value.HeapString.Bytes); }
+	FORCEINLINE const FString& GetHeapString() const { return *reinterpret_cast<const FString*>(Value.HeapString.Bytes); }
+
+	template<typename T>
+	FORCEINLINE T& GetScalar() { return *reinterpret_cast<T*>(&Value); }
+	template<typename T>
+	FORCEINLINE const T& GetScalar() const { return *reinterpret_cast<const T*>(&Value); }
 
 private:
 
-	void FreeData();
+	union FValue
+	{
+		bool Bool;
+		int8 Int8;
+		int16 Int16;
+		int32 Int32;
+		int64 Int64;
+		uint8 UInt8;
+		uint16 UInt16;
+		uint32 UInt32;
+		uint64 UInt64;
+		float Float;
+		double Double;
+
+		/** Used for strings that are longer than InlineStringCapacity. */
+		TTypeCompatibleBytes<FString> HeapString;
+
+		/** Null terminated characters of short strings. */
+		TCHAR InlineString[InlineStringCapacity + 1];
+	};
+
+	FValue Value;
 
-	IVariantData* Data = nullptr;
 	EVariantType::Type Type = EVariantType::Unknown;
+
+	/** Whether a string value is stored in InlineString. */
+	bool bInlineString = false;
+
+	/** Length of the inline string. */
+	uint8 InlineStringLength = 0;
 };
 
 template<typename T>
 inline FVariant::FVariant(const T& InData)
 {
-	typedef typename TVariantType<T>::TData TData;
-
-	Data = new TData(InData);
-	Type = TVariantType<T>::Type;
+	*this = InData;
 }
 
 template<typename T>
 inline FVariant& FVariant::operator=(const T& InData)
 {
-	typedef typename TVariantType<T>::TData TData;
+	if constexpr (TVariantType<T>::Type == EVariantType::String)
+	{
+		if (Type == EVariantType::String && !bInlineString && &GetHeapString() == &InData)
+			return *this;
 
-	FreeData();
+		Empty();
+		SetString(*InData, InData.Length());
+	}
+	else
+	{
+		Empty();
 
-	Data = new TData(InData);
-	Type = TVariantType<T>::Type;
+		GetScalar<T>() = InData;
+		Type = TVariantType<T>::Type;
+	}
 
 	return *this;
 }
 
 template<typename T>
-inline T& FVariant::GetValue()
+inline T FVariant::GetValue() const
 {
-	typedef typename TVariantType<T>::TData TData;
-
 	checkf(Type == TVariantType<T>::Type, TEXT("Invalid type"));
-	return static_cast<TData*>(Data)->Data;
-}
-
-template<typename T>
-inline const T& FVariant::GetValue() const
-{
-	typedef typename TVariantType<T>::TData TData;
 
-	checkf(Type == TVariantType<T>::Type, TEXT("Invalid type"));
-	return static_cast<TData*>(Data)->Data;
+	if constexpr (TVariantType<T>::Type == EVariantType::String)
+		return bInlineString ? FString(Value.InlineString) : GetHeapString();
+	else
+		return GetScalar<T>();
 }
\ No newline at end of file
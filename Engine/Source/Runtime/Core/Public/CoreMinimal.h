@@ -7,6 +7,8 @@
 
 #include "Containers/Map.h"
 #include "Containers/Name.h"
+#include "Containers/InternedString.h"
+#include "Containers/SharedString.h"
 #include "Containers/Variant.h"
 #include "Containers/ArrayView.h"
 #include "Containers/ImpulseString.h"
@@ -8,6 +8,8 @@
 
 #include "Misc/Hash.h"
 
+#include "Memory/Memory.h"
+
 class FDelegateHandle
 {
 public:
@@ -31,6 +33,9 @@ public:
 	FORCEINLINE void Reset() { Handle = 0; }
 	FORCEINLINE bool IsValid() const { return Handle != 0; }
 
+	FORCEINLINE bool operator==(const FDelegateHandle& Other) const { return Handle == Other.Handle; }
+	FORCEINLINE bool operator!=(const FDelegateHandle& Other) const { return Handle != Other.Handle; }
+
 public:
 
 	friend uint32 GetTypeHash(const FDelegateHandle& InHandle)
@@ -49,6 +54,11 @@ private:
 	FAtomic64 Handle{};
 };
 
+// Size in bytes of the inline storage for delegate instances, larger instances are allocated on the heap
+#ifndef IE_DELEGATE_INLINE_SIZE
+	#define IE_DELEGATE_INLINE_SIZE 32
+#endif
+
 namespace IE::Private::Delegate
 {
 	class IDelegateBase
@@ -75,7 +85,24 @@ namespace IE::Private::Delegate
 		*/
 		FORCEINLINE bool IsBound() const
 		{
-			return InstancePtr != nullptr;
+			return bInlineInstance || InstancePtr != nullptr;
+		}
+
+		/**
+		* Unbinds the delegate and resets its handle.
+		*/
+		void Unbind()
+		{
+			FreeInstance();
+			Handle.Reset();
+		}
+
+		/**
+		* Resets the handle but keeps the instance, so a delegate that might be executing can be marked as removed.
+		*/
+		FORCEINLINE void ResetHandle()
+		{
+			Handle.Reset();
 		}
 
 		/**
@@ -84,36 +111,110 @@ namespace IE::Private::Delegate
 		template<typename InRetValType, typename... InParamTypes>
 		FORCEINLINE InRetValType BaseExecution(InParamTypes... InParams)
 		{
-			checkf(InstancePtr, TEXT("Trying to execute an unbound delegate."));
-			return static_cast<TDelegateInstanceBase<InRetValType, InParamTypes...>*>(InstancePtr)->Execute(Forward<InParamTypes>(InParams)...);
+			checkf(IsBound(), TEXT("Trying to execute an unbound delegate."));
+			return static_cast<TDelegateInstanceBase<InRetValType, InParamTypes...>*>(GetInstance())->Execute(Forward<InParamTypes>(InParams)...);
 		}
 
 	protected:
 
 		IDelegateBase()
-			: InstancePtr(nullptr), Handle() {}
-		IDelegateBase(IDelegateInstanceInterface* InInstancePtr)
-			: InstancePtr(InInstancePtr), Handle(FDelegateHandle::GenerateNewHandle) {}
-		IDelegateBase(IDelegateInstanceInterface* InInstancePtr, FDelegateHandle InHandle)
-			: InstancePtr(InInstancePtr), Handle(InHandle) {}
+			: Handle(), InstancePtr(nullptr) {}
 
-		IDelegateInstanceInterface* CloneInstance() const
+		/**
+		* Creates the instance of the delegate and generates a new handle.
+		* Small instances that can't throw while they are moved are stored inline, all other instances are allocated on the heap.
+		*/
+		template<typename InstanceType, typename... ArgTypes>
+		void CreateInstance(ArgTypes&&... Args)
+		{
+			FreeInstance();
+
+			if constexpr (sizeof(InstanceType) <= IE_DELEGATE_INLINE_SIZE && alignof(InstanceType) <= alignof(void*) && std::is_nothrow_move_constructible_v<InstanceType>)
+			{
+				new (InlineStorage) InstanceType(Forward<ArgTypes>(Args)...);
+				bInlineInstance = true;
+			}
+			else
+			{
+				InstancePtr = new InstanceType(Forward<ArgTypes>(Args)...);
+			}
+
+			Handle = FDelegateHandle(FDelegateHandle::GenerateNewHandle);
+		}
+
+		/**
+		* Copies the instance and handle of another delegate.
+		*/
+		void CopyFrom(const IDelegateBase& Other)
+		{
+			FreeInstance();
+
+			if (Other.bInlineInstance)
+			{
+				Other.GetInstance()->CopyTo(InlineStorage);
+				bInlineInstance = true;
+			}
+			else
+			{
+				InstancePtr = Other.InstancePtr ? Other.InstancePtr->Clone() : nullptr;
+			}
+
+			Handle = Other.Handle;
+		}
+
+		/**
+		* Moves the instance and handle of another delegate, leaving the other delegate unbound.
+		*/
+		void MoveFrom(IDelegateBase& Other)
 		{
-			return InstancePtr ? InstancePtr->Clone() : nullptr;
+			FreeInstance();
+
+			if (Other.bInlineInstance)
+			{
+				// The moved from instance is destroyed, instances hold a vtable pointer and can't just be copied byte-wise
+				Other.GetInstance()->MoveTo(InlineStorage);
+				bInlineInstance = true;
+
+				Other.FreeInstance();
+			}
+			else
+			{
+				InstancePtr = Other.InstancePtr;
+
+				Other.InstancePtr = nullptr;
+			}
+
+			Handle = Other.Handle;
+			Other.Handle.Reset();
 		}
 
 		void FreeInstance()
 		{
-			if (InstancePtr)
+			if (bInlineInstance)
+				GetInstance()->~IDelegateInstanceInterface();
+			else if (InstancePtr)
 				delete InstancePtr;
 
+			bInlineInstance = false;
 			InstancePtr = nullptr;
 		}
 
+		FORCEINLINE IDelegateInstanceInterface* GetInstance() const
+		{
+			return bInlineInstance ? reinterpret_cast<IDelegateInstanceInterface*>(const_cast<uint8*>(InlineStorage)) : InstancePtr;
+		}
+
 	protected:
 
 		FDelegateHandle Handle;
+
+		/** Heap allocated instance, only used if the instance doesn't fit into the inline storage. */
 		IDelegateInstanceInterface* InstancePtr;
+
+		/** Inline storage for small instances, see IE_DELEGATE_INLINE_SIZE. */
+		alignas(void*) uint8 InlineStorage[IE_DELEGATE_INLINE_SIZE];
+
+		bool bInlineInstance = false;
 	};
 }
 
@@ -135,24 +236,21 @@ public:
 		: Base() {}
 
 	TDelegate(const TDelegate& Other)
-		: Base(Other.CloneInstance(), Other.Handle) {}
+		: Base()
+	{
+		CopyFrom(Other);
+	}
 
 	TDelegate(TDelegate&& Other) noexcept
-		: Base(Other.InstancePtr, Other.Handle)
+		: Base()
 	{
-		Other.Handle.Reset();
-		Other.InstancePtr = nullptr;
+		MoveFrom(Other);
 	}
 
 	TDelegate& operator=(const TDelegate& Other)
 	{
 		if (this != &Other)
-		{
-			FreeInstance();
-
-			Handle = Other.Handle;
-			InstancePtr = Other.CloneInstance();
-		}
+			CopyFrom(Other);
 
 		return *this;
 	}
@@ -160,27 +258,13 @@ public:
 	TDelegate& operator=(TDelegate&& Other) noexcept
 	{
 		if (this != &Other)
-		{
-			FreeInstance();
-
-			Handle = Other.Handle;
-			Other.Handle.Reset();
-
-			InstancePtr = Other.InstancePtr;
-			Other.InstancePtr = nullptr;
-		}
+			MoveFrom(Other);
 
 		return *this;
-
 	}
 
 	~TDelegate() = default;
 
-protected:
-
-	TDelegate(IE::Private::Delegate::IDelegateInstanceInterface* InInstancePtr)
-		: Base(InInstancePtr) {}
-
 public:
 
 	/**
@@ -208,7 +292,9 @@ public:
 	*/
 	static TDelegate CreateStatic(typename TFuncPtrType<InRetValType, InParamTypes...>::Type InFunc)
 	{
-		return TDelegate(new IE::Private::Delegate::TFuncDelegateInstance<InRetValType, InParamTypes...>(InFunc));
+		TDelegate result;
+		result.template CreateInstance<IE::Private::Delegate::TFuncDelegateInstance<InRetValType, InParamTypes...>>(InFunc);
+		return result;
 	}
 
 	/**
@@ -220,7 +306,9 @@ public:
 	template<typename InUserClass>
 	static TDelegate Create(InUserClass* InUserObject, typename TMemFunPtrType<false, InRetValType, InUserClass, InParamTypes...>::Type InUserMethod)
 	{
-		return TDelegate(new IE::Private::Delegate::TMemDelegateInstance<false, InRetValType, InUserClass, InParamTypes...>(InUserObject, InUserMethod));
+		TDelegate result;
+		result.template CreateInstance<IE::Private::Delegate::TMemDelegateInstance<false, InRetValType, InUserClass, InParamTypes...>>(InUserObject, InUserMethod);
+		return result;
 	}
 
 	/**
@@ -232,7 +320,9 @@ public:
 	template<typename InUserClass>
 	static TDelegate CreateConst(const InUserClass* InUserObject, typename TMemFunPtrType<true, InRetValType, const InUserClass, InParamTypes...>::Type InUserMethod)
 	{
-		return TDelegate(new IE::Private::Delegate::TMemDelegateInstance<true, InRetValType, const InUserClass, InParamTypes...>(InUserObject, InUserMethod));
+		TDelegate result;
+		result.template CreateInstance<IE::Private::Delegate::TMemDelegateInstance<true, InRetValType, const InUserClass, InParamTypes...>>(InUserObject, InUserMethod);
+		return result;
 	}
 
 	/**
@@ -243,6 +333,8 @@ public:
 	template<typename InLambdaSignature>
 	static TDelegate CreateLambda(InLambdaSignature&& InLambda)
 	{
-		return TDelegate(new IE::Private::Delegate::TLambdaDelegateInstance<InLambdaSignature, InRetValType, InParamTypes...>(Forward<InLambdaSignature>(InLambda)));
+		TDelegate result;
+		result.template CreateInstance<IE::Private::Delegate::TLambdaDelegateInstance<typename TDecay<InLambdaSignature>::Type, InRetValType, InParamTypes...>>(Forward<InLambdaSignature>(InLambda));
+		return result;
 	}
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Templates/Decay.h"
 #include "Templates/ImpulseTemplates.h"
 
 /**
@@ -48,6 +49,8 @@ namespace IE::Private::Delegate
 	{
 	public:
 
+		virtual ~IDelegateInstanceInterface() = default;
+
 		/**
 		* Checks if the delegate instance is bound to a particular user object.
 		* @param InUserObject - The user object to check for.
@@ -60,6 +63,18 @@ namespace IE::Private::Delegate
 		* @return The copy of the delegate instance.
 		*/
 		virtual IDelegateInstanceInterface* Clone() const = 0;
+
+		/**
+		* Copy constructs the delegate instance in place.
+		* @param Dest - Uninitialized memory that is large and aligned enough for the instance.
+		*/
+		virtual void CopyTo(void* Dest) const = 0;
+
+		/**
+		* Move constructs the delegate instance in place, this instance still has to be destroyed.
+		* @param Dest - Uninitialized memory that is large and aligned enough for the instance.
+		*/
+		virtual void MoveTo(void* Dest) = 0;
 	};
 
 	template<typename InRetValType, typename... InParamTypes>
@@ -101,6 +116,16 @@ namespace IE::Private::Delegate
 			return new TMemDelegateInstance<bConst, InRetValType, InUserClass, InParamTypes...>(UserObject, UserMethod);
 		}
 
+		virtual void CopyTo(void* Dest) const override
+		{
+			new (Dest) TMemDelegateInstance(*this);
+		}
+
+		virtual void MoveTo(void* Dest) override
+		{
+			new (Dest) TMemDelegateInstance(MoveTemp(*this));
+		}
+
 	private:
 
 		InUserClass* UserObject;
@@ -133,6 +158,16 @@ namespace IE::Private::Delegate
 			return new TFuncDelegateInstance<InRetValType, InParamTypes...>(Func);
 		}
 
+		virtual void CopyTo(void* Dest) const override
+		{
+			new (Dest) TFuncDelegateInstance(*this);
+		}
+
+		virtual void MoveTo(void* Dest) override
+		{
+			new (Dest) TFuncDelegateInstance(MoveTemp(*this));
+		}
+
 	private:
 
 		FuncType Func;
@@ -164,6 +199,16 @@ namespace IE::Private::Delegate
 			return new TLambdaDelegateInstance<LambdaSignature, InRetValType, InParamTypes...>(Func);
 		}
 
+		virtual void CopyTo(void* Dest) const override
+		{
+			new (Dest) TLambdaDelegateInstance(*this);
+		}
+
+		virtual void MoveTo(void* Dest) override
+		{
+			new (Dest) TLambdaDelegateInstance(MoveTemp(*this));
+		}
+
 	private:
 
 		mutable FuncType Func;
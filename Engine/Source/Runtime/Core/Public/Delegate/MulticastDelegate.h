@@ -2,10 +2,16 @@
 
 #include "Delegate.h"
 
-#include "Containers/Map.h"
-
-#include "Platform/PlatformAtomics.h"
+#include "Containers/Array.h"
 
+/**
+* Delegate which can be bound to multiple functions.
+*
+* Bound delegates are stored in a contiguous invocation list, small delegate instances live inline in the list.
+* Delegates may be added or removed while broadcasting: Removed delegates only lose their handle and are skipped,
+* they are destroyed once the outermost broadcast finished, as a delegate might remove itself while it is executing.
+* Added delegates are appended after the outermost broadcast finished.
+*/
 template<typename... ParamTypes>
 class TMulticastDelegate
 {
@@ -13,28 +19,101 @@ public:
 
 	using FDelegate = TDelegate<void(ParamTypes...)>;
 
+public:
+
+	TMulticastDelegate() = default;
+
+	TMulticastDelegate(const TMulticastDelegate& Other)
+	{
+		CopyFrom(Other);
+	}
+
+	TMulticastDelegate& operator=(const TMulticastDelegate& Other)
+	{
+		if (this != &Other)
+		{
+			checkf(BroadcastDepth == 0, TEXT("Trying to assign to a multicast delegate while it is broadcasting."));
+
+			Invocations.Empty();
+			PendingInvocations.Empty();
+			NumRemoved = 0;
+
+			CopyFrom(Other);
+		}
+
+		return *this;
+	}
+
 public:
 
 	/**
 	* Adds a new delegate to the multicast delegate.
-	 *
-	 * @param Delegate The delegate to add.
-	 * @return A handle to the delegate.
+	* A delegate with the handle of a delegate that was already added is ignored.
+	* @param Delegate - The delegate to add.
+	* @return A handle to the delegate.
 	*/
 	FDelegateHandle Add(const FDelegate& Delegate)
 	{
-		Delegates.Add(Delegate.GetHandle(), Delegate);
-		return Delegate.GetHandle();
+		return Add(FDelegate(Delegate));
+	}
+
+	/**
+	* Adds a new delegate to the multicast delegate.
+	* A delegate with the handle of a delegate that was already added is ignored.
+	* @param Delegate - The delegate to add.
+	* @return A handle to the delegate.
+	*/
+	FDelegateHandle Add(FDelegate&& Delegate)
+	{
+		const FDelegateHandle handle = Delegate.GetHandle();
+		if (!Delegate.IsBound() || Contains(handle))
+			return handle;
+
+		if (BroadcastDepth > 0)
+		{
+			// The invocation list must not be reallocated while broadcasting
+			PendingInvocations.Add(MoveTemp(Delegate));
+		}
+		else
+		{
+			Compact();
+			Invocations.Add(MoveTemp(Delegate));
+		}
+
+		return handle;
 	}
 
 	/**
 	* Removes a delegate from the multicast delegate.
-	 *
-	 * @param Handle The handle to the delegate to remove.
+	* @param Handle - The handle to the delegate to remove.
 	*/
 	void Remove(FDelegateHandle Handle)
 	{
-		Delegates.Remove(Handle);
+		if (!Handle.IsValid())
+			return;
+
+		for (int32 i = 0; i < Invocations.Num(); ++i)
+		{
+			if (Invocations[i].GetHandle() == Handle)
+			{
+				if (BroadcastDepth > 0)
+					Invocations[i].ResetHandle();
+				else
+					Invocations[i].Unbind();
+
+				++NumRemoved;
+				return;
+			}
+		}
+
+		for (int32 i = 0; i < PendingInvocations.Num(); ++i)
+		{
+			if (PendingInvocations[i].GetHandle() == Handle)
+			{
+				PendingInvocations[i].Unbind();
+				return;
+			}
+		}
 	}
 
 	/**
@@ -42,63 +121,171 @@ public:
 	*/
 	void Clear()
 	{
-		Delegates.Clear();
+		if (BroadcastDepth > 0)
+		{
+			for (int32 i = 0; i < Invocations.Num(); ++i)
+				Invocations[i].ResetHandle();
+
+			NumRemoved = Invocations.Num();
+			PendingInvocations.Empty();
+		}
+		else
+		{
+			Invocations.Empty();
+			PendingInvocations.Empty();
+			NumRemoved = 0;
+		}
 	}
 
 	/**
 	* Invokes all delegates in the multicast delegate.
-	 *
-	 * @param Params The parameters to pass to the delegates.
+	* @param Params - The parameters to pass to the delegates.
 	*/
 	void Broadcast(ParamTypes... Params)
 	{
-		for (auto& Delegate : Delegates)
+		++BroadcastDepth;
+
+		// Delegates added during the broadcast are pending, so the number of invocations can't grow
+
+		const int32 num = Invocations.Num();
+		for (int32 i = 0; i < num; ++i)
 		{
-			Delegate.GetValue().Execute(Forward<ParamTypes>(Params)...);
+			FDelegate& delegate = Invocations[i];
+			if (IsActive(delegate))
+				delegate.Execute(Params...);
+		}
+
+		if (--BroadcastDepth == 0)
+		{
+			Compact();
+
+			for (int32 i = 0; i < PendingInvocations.Num(); ++i)
+			{
+				if (PendingInvocations[i].IsBound())
+					Invocations.Add(MoveTemp(PendingInvocations[i]));
+			}
+
+			PendingInvocations.Empty();
 		}
 	}
 
 	/**
 	* Checks whether the multicast delegate is empty.
-	 *
-	 * @return true if the multicast delegate is empty, false otherwise.
+	* @return true if the multicast delegate is empty, false otherwise.
 	*/
 	bool IsEmpty() const
 	{
-		return Delegates.Num() == 0;
+		return GetNumDelegates() == 0;
 	}
 
 	/**
 	* Checks whether the multicast delegate is bound to a single delegate.
-	 *
-	 * @return true if the multicast delegate is bound to a single delegate, false otherwise.
+	* @return true if the multicast delegate is bound to a single delegate, false otherwise.
 	*/
 	bool IsBound() const
 	{
-		return Delegates.Num() == 1;
+		return GetNumDelegates() == 1;
 	}
 
 	/**
 	* Checks whether the multicast delegate is bound to more than one delegate.
-	 *
-	 * @return true if the multicast delegate is bound to more than one delegate, false otherwise.
+	* @return true if the multicast delegate is bound to more than one delegate, false otherwise.
 	*/
 	bool IsBoundToMany() const
 	{
-		return Delegates.Num() > 1;
+		return GetNumDelegates() > 1;
 	}
 
 	/**
 	* Gets the number of delegates in the multicast delegate.
-	 *
-	 * @return The number of delegates in the multicast delegate.
+	* @return The number of delegates in the multicast delegate.
 	*/
 	int32 GetNumDelegates() const
 	{
-		return Delegates.Num();
+		int32 numPending = 0;
+		for (int32 i = 0; i < PendingInvocations.Num(); ++i)
+			numPending += PendingInvocations[i].IsBound() ? 1 : 0;
+
+		return Invocations.Num() - NumRemoved + numPending;
 	}
 
 private:
 
-	TMap<FDelegateHandle, FDelegate> Delegates;
+	// @return False if the delegate was removed from the invocation list, removed delegates are unbound or have no handle
+	static FORCEINLINE bool IsActive(const FDelegate& Delegate)
+	{
+		return Delegate.IsBound() && Delegate.GetHandle().IsValid();
+	}
+
+	// @return True if a delegate with the handle is bound and wasn't removed
+	bool Contains(FDelegateHandle Handle) const
+	{
+		for (int32 i = 0; i < Invocations.Num(); ++i)
+		{
+			if (Invocations[i].GetHandle() == Handle && IsActive(Invocations[i]))
+				return true;
+		}
+
+		for (int32 i = 0; i < PendingInvocations.Num(); ++i)
+		{
+			if (PendingInvocations[i].GetHandle() == Handle && PendingInvocations[i].IsBound())
+				return true;
+		}
+
+		return false;
+	}
+
+	/**
+	* Destroys the removed delegates of the invocation list, keeping the order of the remaining ones.
+	* Does nothing while broadcasting.
+	*/
+	void Compact()
+	{
+		if (NumRemoved == 0 || BroadcastDepth > 0)
+			return;
+
+		int32 writeIndex = 0;
+		for (int32 readIndex = 0; readIndex < Invocations.Num(); ++readIndex)
+		{
+			if (!IsActive(Invocations[readIndex]))
+				continue;
+
+			if (writeIndex != readIndex)
+				Invocations[writeIndex] = MoveTemp(Invocations[readIndex]);
+
+			++writeIndex;
+		}
+
+		Invocations.SetNum(writeIndex);
+		NumRemoved = 0;
+	}
+
+	void CopyFrom(const TMulticastDelegate& Other)
+	{
+		for (int32 i = 0; i < Other.Invocations.Num(); ++i)
+		{
+			if (IsActive(Other.Invocations[i]))
+				Invocations.Add(Other.Invocations[i]);
+		}
+
+		for (int32 i = 0; i < Other.PendingInvocations.Num(); ++i)
+		{
+			if (Other.PendingInvocations[i].IsBound())
+				Invocations.Add(Other.PendingInvocations[i]);
+		}
+	}
+
+private:
+
+	/** Contiguous list of bound delegates, removed delegates stay in the list until it is compacted. */
+	TArray<FDelegate> Invocations;
+
+	/** Delegates added while broadcasting. */
+	TArray<FDelegate> PendingInvocations;
+
+	/** Number of removed delegates in the invocation list. */
+	int32 NumRemoved = 0;
+
+	/** Depth of nested broadcasts. */
+	int32 BroadcastDepth = 0;
 };
\ No newline at end of file
@@ -0,0 +1,254 @@
+#pragma once
+
+#include "MulticastDelegate.h"
+
+#include "Containers/Array.h"
+
+#include "Templates/Decay.h"
+#include "Templates/ImpulseTuple.h"
+#include "Templates/TypeCompatibleBytes.h"
+
+#include "Platform/PlatformMisc.h"
+#include "Platform/PlatformAtomics.h"
+
+/**
+* Multicast delegate whose broadcasts are queued and dispatched later on a single dispatch thread.
+*
+* Enqueue may be called from any thread, payloads are stored in a bounded lock-free ring buffer
+* which is allocated once, so steady-state broadcasting does no allocation.
+* Add, Remove and Dispatch must only be called from the dispatch thread.
+*/
+template<typename... ParamTypes>
+class TQueuedMulticastDelegate
+{
+public:
+
+	using FDelegate = typename TMulticastDelegate<ParamTypes...>::FDelegate;
+
+private:
+
+	using FPayload = TTuple<typename TDecay<ParamTypes>::Type...>;
+
+	/** Number of payloads DispatchForSeconds dispatches between reads of the clock. */
+	static constexpr int32 DispatchBatchSize = 16;
+
+	struct FCell
+	{
+		/** Position the cell is ready for, see Enqueue and Dispatch. */
+		volatile FAtomic64 Sequence = 0;
+
+		TTypeCompatibleBytesPtr<FPayload> Payload;
+	};
+
+public:
+
+	/**
+	* @param InCapacity - Maximum number of queued broadcasts, rounded up to the next power of two.
+	*/
+	explicit TQueuedMulticastDelegate(int32 InCapacity = 1024)
+	{
+		int32 capacity = 2;
+		while (capacity < InCapacity)
+			capacity <<= 1;
+
+		Cells.SetNum(capacity);
+		for (int32 i = 0; i < capacity; ++i)
+			Cells[i].Sequence = i;
+
+		Mask = capacity - 1;
+	}
+
+	TQueuedMulticastDelegate(const TQueuedMulticastDelegate&) = delete;
+	TQueuedMulticastDelegate& operator=(const TQueuedMulticastDelegate&) = delete;
+
+	~TQueuedMulticastDelegate()
+	{
+		// Destroy payloads that were never dispatched
+
+		while (FCell* cell = PeekCell())
+			PopCell(cell);
+	}
+
+public:
+
+	/**
+	* Adds a new delegate, which will be invoked for every dispatched broadcast.
+	* @param Delegate - The delegate to add.
+	* @return A handle to the delegate.
+	*/
+	FDelegateHandle Add(const FDelegate& Delegate)
+	{
+		return Delegates.Add(Delegate);
+	}
+
+	/**
+	* Removes a delegate.
+	* @param Handle - The handle to the delegate to remove.
+	*/
+	void Remove(FDelegateHandle Handle)
+	{
+		Delegates.Remove(Handle);
+	}
+
+	/**
+	* Queues a broadcast. Thread-safe and lock-free.
+	* @param Params - The parameters to pass to the delegates, moved into the queue unless they are references.
+	* @return true if the broadcast was queued, false if the queue is full.
+	*/
+	bool Enqueue(ParamTypes... Params)
+	{
+		FAtomic64 pos = FPlatformAtomics::AtomicRead64(&EnqueuePos);
+
+		for (;;)
+		{
+			FCell& cell = Cells[static_cast<int32>(pos & Mask)];
+			const FAtomic64 diff = FPlatformAtomics::AtomicRead64(&cell.Sequence) - pos;
+
+			if (diff == 0)
+			{
+				// The cell is free, try to claim it
+
+				const FAtomic64 prevPos = FPlatformAtomics::InterlockedCompareExchange64(&EnqueuePos, pos + 1, pos);
+				if (prevPos == pos)
+				{
+					new (cell.Payload.GetPtr()) FPayload(Forward<ParamTypes>(Params)...);
+
+					// Publish the payload to the dispatch thread
+					FPlatformAtomics::InterlockedExchange64(&cell.Sequence, pos + 1);
+
+					return true;
+				}
+
+				pos = prevPos;
+			}
+			else if (diff < 0)
+			{
+				// The cell still holds a payload from the previous lap
+				return false;
+			}
+			else
+			{
+				pos = FPlatformAtomics::AtomicRead64(&EnqueuePos);
+			}
+		}
+	}
+
+	/**
+	* Broadcasts queued payloads to all bound delegates, in the order they were queued.
+	* @param MaxBroadcasts - Maximum number of payloads to dispatch.
+	* @return Number of dispatched payloads.
+	*/
+	int32 Dispatch(int32 MaxBroadcasts = MAX_int32)
+	{
+		int32 numDispatched = 0;
+
+		while (numDispatched < MaxBroadcasts)
+		{
+			FCell* cell = PeekCell();
+			if (!cell)
+				break;
+
+			// Pop the cell before broadcasting, a delegate might dispatch again
+			FPayload payload(MoveTemp(*cell->Payload.GetPtr()));
+			PopCell(cell);
+
+			BroadcastPayload(payload);
+
+			++numDispatched;
+		}
+
+		return numDispatched;
+	}
+
+	/**
+	* Broadcasts queued payloads until the queue is empty or the time budget is exhausted.
+	* Payloads are dispatched in batches of DispatchBatchSize and the clock is only read between batches,
+	* so the budget can be exceeded by up to one batch. At least one batch is dispatched if the queue isn't empty.
+	* @param BudgetSeconds - Time budget for this call, in seconds.
+	* @return Number of dispatched payloads.
+	*/
+	int32 DispatchForSeconds(double BudgetSeconds)
+	{
+		const double endTime = FPlatformMisc::Seconds() + BudgetSeconds;
+
+		int32 numDispatched = 0;
+		for (;;)
+		{
+			const int32 numBatch = Dispatch(DispatchBatchSize);
+			numDispatched += numBatch;
+
+			if (numBatch < DispatchBatchSize || FPlatformMisc::Seconds() >= endTime)
+				break;
+		}
+
+		return numDispatched;
+	}
+
+	/**
+	* Checks whether broadcasts are queued.
+	* Only accurate on the dispatch thread, other threads may be enqueuing concurrently.
+	* @return true if at least one broadcast is queued, false otherwise.
+	*/
+	bool HasPendingBroadcasts() const
+	{
+		const FCell& cell = Cells[static_cast<int32>(DequeuePos & Mask)];
+		return FPlatformAtomics::AtomicRead64(&cell.Sequence) == DequeuePos + 1;
+	}
+
+	/**
+	* Gets the number of bound delegates.
+	* @return The number of bound delegates.
+	*/
+	int32 GetNumDelegates() const
+	{
+		return Delegates.GetNumDelegates();
+	}
+
+private:
+
+	/**
+	* Gets the cell holding the next payload to dispatch.
+	* @return The cell, or nullptr if no payload has been published yet.
+	*/
+	FCell* PeekCell()
+	{
+		FCell& cell = Cells[static_cast<int32>(DequeuePos & Mask)];
+		return FPlatformAtomics::AtomicRead64(&cell.Sequence) == DequeuePos + 1 ? &cell : nullptr;
+	}
+
+	/**
+	* Destroys the payload of the cell and hands the cell back to the producers for the next lap.
+	*/
+	void PopCell(FCell* Cell)
+	{
+		DestructItem<FPayload>(Cell->Payload.GetPtr());
+		FPlatformAtomics::InterlockedExchange64(&Cell->Sequence, DequeuePos + Mask + 1);
+
+		++DequeuePos;
+	}
+
+	template<typename TupleType, typename... UnpackedTypes>
+	void BroadcastPayload(TupleType& Tuple, UnpackedTypes&... Unpacked)
+	{
+		if constexpr (TupleType::IsEmpty())
+			Delegates.Broadcast(Unpacked...);
+		else
+			BroadcastPayload(Tuple.GetBase(), Unpacked..., Tuple.Value);
+	}
+
+private:
+
+	/** The delegates that are invoked on dispatch. */
+	TMulticastDelegate<ParamTypes...> Delegates;
+
+	/** Ring buffer of payloads, allocated once. */
+	TArray<FCell> Cells;
+
+	FAtomic64 Mask = 0;
+
+	/** Next position to enqueue to, shared by all producers. */
+	alignas(64) volatile FAtomic64 EnqueuePos = 0;
+
+	/** Next position to dispatch, only accessed by the dispatch thread. */
+	alignas(64) FAtomic64 DequeuePos = 0;
+};
\ No newline at end of file
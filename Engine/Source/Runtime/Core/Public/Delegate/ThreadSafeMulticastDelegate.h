@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Delegate.h"
+
+#include "Containers/Array.h"
+
+#include "Templates/AtomicSharedPtr.h"
+
+#include "Misc/ScopeLock.h"
+
+/**
+* Multicast delegate which can be bound, unbound and broadcast from multiple threads.
+*
+* The invocation list is immutable and published through a TAtomicSharedPtr:
+* Broadcast only loads the current list and never blocks, Add and Remove copy the list under a lock.
+* A broadcast that already started may still invoke a delegate that is being removed concurrently.
+*/
+template<typename... ParamTypes>
+class TThreadSafeMulticastDelegate
+{
+public:
+
+	using FDelegate = TDelegate<void(ParamTypes...)>;
+
+private:
+
+	using FInvocationList = TArray<FDelegate>;
+	using FInvocationListPtr = typename TAtomicSharedPtr<FInvocationList>::SharedPtrType;
+
+public:
+
+	TThreadSafeMulticastDelegate() = default;
+
+	TThreadSafeMulticastDelegate(const TThreadSafeMulticastDelegate&) = delete;
+	TThreadSafeMulticastDelegate& operator=(const TThreadSafeMulticastDelegate&) = delete;
+
+public:
+
+	/**
+	* Adds a new delegate to the multicast delegate.
+	* @param Delegate - The delegate to add.
+	* @return A handle to the delegate.
+	*/
+	FDelegateHandle Add(const FDelegate& Delegate)
+	{
+		if (!Delegate.IsBound())
+			return Delegate.GetHandle();
+
+		FScopeLock lock(&WriteCriticalSection);
+
+		FInvocationListPtr current = Invocations.Load();
+		FInvocationList* invocations = current ? new FInvocationList(*current) : new FInvocationList();
+
+		invocations->Add(Delegate);
+		Invocations.Store(FInvocationListPtr(invocations));
+
+		return Delegate.GetHandle();
+	}
+
+	/**
+	* Removes a delegate from the multicast delegate.
+	* @param Handle - The handle to the delegate to remove.
+	*/
+	void Remove(FDelegateHandle Handle)
+	{
+		FScopeLock lock(&WriteCriticalSection);
+
+		FInvocationListPtr current = Invocations.Load();
+		if (!current)
+			return;
+
+		int32 index = INDEX_NONE;
+		for (int32 i = 0; i < current->Num() && index == INDEX_NONE; ++i)
+		{
+			if ((*current)[i].GetHandle() == Handle)
+				index = i;
+		}
+
+		if (index == INDEX_NONE)
+			return;
+
+		if (current->Num() == 1)
+		{
+			Invocations.Store(FInvocationListPtr());
+			return;
+		}
+
+		FInvocationList* invocations = new FInvocationList();
+		for (int32 i = 0; i < current->Num(); ++i)
+		{
+			if (i != index)
+				invocations->Add((*current)[i]);
+		}
+
+		Invocations.Store(FInvocationListPtr(invocations));
+	}
+
+	/**
+	* Removes all delegates from the multicast delegate.
+	*/
+	void Clear()
+	{
+		FScopeLock lock(&WriteCriticalSection);
+		Invocations.Store(FInvocationListPtr());
+	}
+
+	/**
+	* Invokes all delegates in the multicast delegate.
+	* @param Params - The parameters to pass to the delegates.
+	*/
+	void Broadcast(ParamTypes... Params) const
+	{
+		FInvocationListPtr invocations = Invocations.Load();
+		if (!invocations)
+			return;
+
+		for (int32 i = 0; i < invocations->Num(); ++i)
+			(*invocations)[i].Execute(Params...);
+	}
+
+	/**
+	* Gets the number of delegates in the multicast delegate.
+	* @return The number of delegates in the multicast delegate.
+	*/
+	int32 GetNumDelegates() const
+	{
+		FInvocationListPtr invocations = Invocations.Load();
+		return invocations ? invocations->Num() : 0;
+	}
+
+	/**
+	* Checks whether the multicast delegate is empty.
+	* @return true if the multicast delegate is empty, false otherwise.
+	*/
+	bool IsEmpty() const
+	{
+		return GetNumDelegates() == 0;
+	}
+
+private:
+
+	/** The currently published invocation list, null if no delegate is bound. */
+	TAtomicSharedPtr<FInvocationList> Invocations;
+
+	/** Serializes writers, readers never lock. */
+	FCriticalSection WriteCriticalSection;
+};
\ No newline at end of file
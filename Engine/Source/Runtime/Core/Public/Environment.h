@@ -10,13 +10,19 @@ class FEnvironment
 {
 public:
 
-	FEnvironment();
+	FEnvironment() = default;
 	FEnvironment(const FEnvironment&) = delete;
 	FEnvironment(FEnvironment&&) = delete;
 
 	FEnvironment& operator=(const FEnvironment&) = delete;
 	FEnvironment& operator=(FEnvironment&&) = delete;
 
+	/**
+	* Reads the environment from the command line.
+	* Call it after FCommandLine::Init, GEnvironment is constructed during static initialization when there is no command line yet.
+	*/
+	CORE_API void Init();
+
 	/** Whether the app is single threaded or not. */
 	inline bool IsSingleThreaded() const { return bIsSingleThreaded; }
 
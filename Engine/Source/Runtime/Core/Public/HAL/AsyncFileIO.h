@@ -0,0 +1,304 @@
+#pragma once
+
+#include "HAL/Filesystem.h"
+
+#include "Containers/Array.h"
+
+#include "Templates/Function.h"
+#include "Templates/SharedPtr.h"
+
+#include "Platform/PlatformEvent.h"
+#include "Platform/PlatformThread.h"
+#include "Platform/PlatformAtomics.h"
+
+#include "Misc/ScopeLock.h"
+
+enum class EAsyncIOPriority : uint8
+{
+	Low,
+	Normal,
+	High,
+
+	// Served before everything else, e.g. data the current frame is blocked on
+	Critical,
+
+	Count
+};
+
+enum class EAsyncIOStatus : uint8
+{
+	// Queued, can still be cancelled
+	Pending,
+
+	// Being read or written by a worker thread
+	InFlight,
+
+	Completed,
+	Failed,
+	Cancelled,
+};
+
+/**
+* Base class of asynchronous file requests.
+* Requests are created by FAsyncFileIO and shared between the caller and the worker threads.
+*/
+class CORE_API FAsyncIORequest
+{
+	friend class FAsyncFileIO;
+
+public:
+
+	FAsyncIORequest(const FAsyncIORequest&) = delete;
+	FAsyncIORequest& operator=(const FAsyncIORequest&) = delete;
+
+	virtual ~FAsyncIORequest() = default;
+
+	/**
+	* Cancels the request if it hasn't been picked up by a worker thread yet.
+	* The completion callback is invoked on the calling thread with the Cancelled status.
+	* @return true if the request was cancelled, false if it is already in flight or done.
+	*/
+	bool Cancel();
+
+	/**
+	* Blocks until the request is done and its completion callback returned.
+	* @param WaitTime - The time to wait in milliseconds (0 means infinite).
+	* @return true if the request is done, false if the wait timed out.
+	*/
+	bool WaitForCompletion(uint32 WaitTime = 0);
+
+	FORCEINLINE EAsyncIOStatus GetStatus() const { return static_cast<EAsyncIOStatus>(FPlatformAtomics::AtomicRead(&Status)); }
+	FORCEINLINE bool IsDone() const { return GetStatus() > EAsyncIOStatus::InFlight; }
+	FORCEINLINE bool Succeeded() const { return GetStatus() == EAsyncIOStatus::Completed; }
+
+	FORCEINLINE FFileHandle GetFileHandle() const { return Handle; }
+	FORCEINLINE uint64 GetOffset() const { return Offset; }
+	FORCEINLINE uint64 GetSize() const { return Size; }
+	FORCEINLINE EAsyncIOPriority GetPriority() const { return Priority; }
+
+	// @return Number of bytes read or written, only valid once the request is done
+	FORCEINLINE uint64 GetBytesTransferred() const { return BytesTransferred; }
+
+protected:
+
+	FAsyncIORequest(FFileHandle InHandle, uint64 InOffset, uint64 InSize, EAsyncIOPriority InPriority);
+
+	virtual bool IsRead() const = 0;
+	virtual void InvokeCallback() = 0;
+
+private:
+
+	/**
+	* Atomically moves the request from one status to another.
+	* @return true if the request had the expected status, false otherwise.
+	*/
+	bool TransitionStatus(EAsyncIOStatus From, EAsyncIOStatus To);
+
+	/**
+	* Sets the final status, invokes the completion callback and releases the waiting threads.
+	*/
+	void Complete(EAsyncIOStatus FinalStatus, uint64 InBytesTransferred);
+
+private:
+
+	FFileHandle Handle;
+	uint64 Offset;
+	uint64 Size;
+	EAsyncIOPriority Priority;
+
+	uint64 BytesTransferred = 0;
+
+	volatile FAtomic Status = static_cast<FAtomic>(EAsyncIOStatus::Pending);
+
+	// Manual reset, stays triggered once the request is done
+	FEvent DoneEvent;
+};
+
+/**
+* Asynchronous read of a range of a file.
+*/
+class CORE_API FAsyncReadRequest final : public FAsyncIORequest
+{
+	friend class FAsyncFileIO;
+
+public:
+
+	using FCallback = TUniqueFunction<void(FAsyncReadRequest&)>;
+
+	FAsyncReadRequest(FFileHandle InHandle, uint64 InOffset, uint64 InSize, uint8* InBuffer, EAsyncIOPriority InPriority, FCallback&& InCallback);
+
+	/**
+	* Gets the buffer the data is read into.
+	* This is either the buffer passed to FAsyncFileIO::Read or a buffer owned by the request.
+	* @return The buffer, only valid to read once the request completed.
+	*/
+	FORCEINLINE uint8* GetData() { return Buffer ? Buffer : OwnedBuffer.GetData(); }
+	FORCEINLINE const uint8* GetData() const { return Buffer ? Buffer : OwnedBuffer.GetData(); }
+
+	/**
+	* Moves the data out of a request that owns its buffer.
+	* @return The read bytes, empty if the data was read into a caller provided buffer.
+	*/
+	FORCEINLINE TArray<uint8> TakeData() { return MoveTemp(OwnedBuffer); }
+
+protected:
+
+	FORCEINLINE bool IsRead() const override { return true; }
+	void InvokeCallback() override;
+
+private:
+
+	uint8* Buffer;
+	TArray<uint8> OwnedBuffer;
+
+	FCallback Callback;
+};
+
+/**
+* Asynchronous write of a range of a file.
+* The data isn't copied, it has to stay valid until the request is done.
+*/
+class CORE_API FAsyncWriteRequest final : public FAsyncIORequest
+{
+	friend class FAsyncFileIO;
+
+public:
+
+	using FCallback = TUniqueFunction<void(FAsyncWriteRequest&)>;
+
+	FAsyncWriteRequest(FFileHandle InHandle, uint64 InOffset, uint64 InSize, const uint8* InData, EAsyncIOPriority InPriority, FCallback&& InCallback);
+
+	FORCEINLINE const uint8* GetData() const { return Data; }
+
+protected:
+
+	FORCEINLINE bool IsRead() const override { return false; }
+	void InvokeCallback() override;
+
+private:
+
+	const uint8* Data;
+
+	FCallback Callback;
+};
+
+typedef TSharedPtr<FAsyncIORequest, ESPMode::ThreadSafe> FAsyncIORequestPtr;
+typedef TSharedPtr<FAsyncReadRequest, ESPMode::ThreadSafe> FAsyncReadRequestPtr;
+typedef TSharedPtr<FAsyncWriteRequest, ESPMode::ThreadSafe> FAsyncWriteRequestPtr;
+
+/**
+* Asynchronous file I/O subsystem.
+*
+* Requests are queued per priority and served by a pool of worker threads using positional reads and writes,
+* so any number of requests can be in flight on the same file handle.
+* Pending reads of adjacent ranges of the same file are coalesced into a single read.
+* Completion callbacks are invoked on the worker threads and should be short.
+*/
+class CORE_API FAsyncFileIO
+{
+public:
+
+	/** Maximum number of bytes read by one coalesced read. */
+	static constexpr uint64 MaxCoalescedBytes = 1024 * 1024;
+
+	/** Number of worker threads started by default. */
+	static constexpr int32 DefaultNumWorkers = 4;
+
+public:
+
+	FAsyncFileIO() = default;
+	FAsyncFileIO(const FAsyncFileIO&) = delete;
+	FAsyncFileIO& operator=(const FAsyncFileIO&) = delete;
+
+	~FAsyncFileIO();
+
+	/**
+	* Gets the global async I/O subsystem.
+	* @return The async I/O subsystem.
+	*/
+	static FAsyncFileIO& Get();
+
+	/**
+	* Starts the worker threads, called implicitly by the first request.
+	* @param NumWorkers - Number of worker threads to start.
+	*/
+	void Startup(int32 NumWorkers = DefaultNumWorkers);
+
+	/**
+	* Cancels all pending requests and waits for the in flight requests and the worker threads to finish.
+	* Should be called before the application exits.
+	*/
+	void Shutdown();
+
+	/**
+	* Queues a read of a range of a file.
+	* @param Handle - Handle to the file to read from, has to stay open until the request is done
+	* @param Offset - Offset in the file to start reading at
+	* @param Size - Number of bytes to read
+	* @param Buffer - Buffer to read into, at least Size bytes, nullptr lets the request allocate the buffer
+	* @param Priority - Priority of the request
+	* @param Callback - Invoked once the request is done
+	* @return The request, or a null pointer if the subsystem is shut down
+	*/
+	FAsyncReadRequestPtr Read(FFileHandle Handle, uint64 Offset, uint64 Size, uint8* Buffer = nullptr, EAsyncIOPriority Priority = EAsyncIOPriority::Normal, FAsyncReadRequest::FCallback&& Callback = FAsyncReadRequest::FCallback());
+
+	/**
+	* Queues a write of a range of a file.
+	* @param Handle - Handle to the file to write to, has to stay open until the request is done
+	* @param Offset - Offset in the file to start writing at
+	* @param Data - Data to write, has to stay valid until the request is done
+	* @param Size - Number of bytes to write
+	* @param Priority - Priority of the request
+	* @param Callback - Invoked once the request is done
+	* @return The request, or a null pointer if the subsystem is shut down
+	*/
+	FAsyncWriteRequestPtr Write(FFileHandle Handle, uint64 Offset, const uint8* Data, uint64 Size, EAsyncIOPriority Priority = EAsyncIOPriority::Normal, FAsyncWriteRequest::FCallback&& Callback = FAsyncWriteRequest::FCallback());
+
+	// @return Number of queued requests that haven't been picked up by a worker thread yet
+	int32 GetNumPendingRequests();
+
+private:
+
+	void Enqueue(const FAsyncIORequestPtr& Request);
+
+	// Has to be called with the queue lock held
+	void StartWorkers(int32 NumWorkers);
+
+	/**
+	* Takes the next request and all pending reads it can be coalesced with off the queues.
+	* @param OutBatch - Receives the requests, sorted by offset.
+	* @return false if the queues are empty.
+	*/
+	bool DequeueBatch(TArray<FAsyncIORequestPtr>& OutBatch);
+
+	void ExecuteBatch(TArray<FAsyncIORequestPtr>& Batch, TArray<uint8>& ScratchBuffer);
+
+	struct FRequestQueue
+	{
+		/** Requests in submission order, taken requests are reset to null until the queue is compacted. */
+		TArray<FAsyncIORequestPtr> Requests;
+
+		/** Index of the first request that wasn't taken from the front. */
+		int32 Head = 0;
+	};
+
+	// Removes the taken requests once they make up half of the queue, so taking a request is amortized constant time
+	static void CompactQueue(FRequestQueue& Queue);
+
+	static void WorkerMain(void* Parameter);
+
+private:
+
+	/** Pending requests of each priority. */
+	FRequestQueue Queues[static_cast<int32>(EAsyncIOPriority::Count)];
+
+	/** Guards the queues and the worker state. */
+	FCriticalSection QueueCriticalSection;
+
+	/** Triggered while requests are queued or the subsystem is shutting down. */
+	FEvent WorkEvent{ true };
+
+	TArray<FThread> Workers;
+
+	bool bStopping = false;
+};
\ No newline at end of file
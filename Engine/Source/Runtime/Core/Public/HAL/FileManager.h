@@ -3,12 +3,48 @@
 #include "CoreModule.h"
 #include "Filesystem.h"
 
+#include "Misc/Compression.h"
+
 #include "Serialization/Archive.h"
 
-#define IE_PACKAGED_FILE_METADATA_VERSION 1
-#define IE_PACKAGED_FILES_METADATA_VERSION 1
+#define IE_PACKAGED_FILE_METADATA_VERSION 5
+#define IE_PACKAGED_FILES_METADATA_VERSION 5
+
+#define IE_PACKAGED_FILES_FILENAME "pak.ipak" // pak.ipak = Impulse Package, the file data followed by the metadata
+
+#define IE_PACKAGED_FILES_MAGIC 0x4B415049 // "IPAK"
+
+// Alignment of the file data in the package, so views of packaged files can be read as aligned data
+#define IE_PACKAGED_FILES_ALIGNMENT 16
+
+// Default size of the blocks compressed files are split into, blocks are compressed and decompressed independently
+#define IE_PACKAGED_FILES_COMPRESSION_BLOCK_SIZE (64 * 1024)
 
-#define IE_PACKAGED_FILES_METADATA_FILENAME "pak.imdta" // pak.imdta = Impulse Packaged Metadata
+// Size of the ranges of uncompressed files that have their own checksum, reads only verify the ranges they touch
+#define IE_PACKAGED_FILES_CHECKSUM_RANGE_SIZE (64 * 1024)
+
+/**
+* Block of a compressed file in the package.
+*/
+struct FPackagedFileBlock
+{
+	/** Offset of the block in the package. */
+	uint64 Offset = 0;
+
+	/** Size of the block in the package, blocks whose compressed size equals their uncompressed size are stored as is. */
+	uint32 CompressedSize = 0;
+
+	/** CRC32C of the block as stored in the package, serialized with the file metadata since version 4. */
+	uint32 Checksum = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FPackagedFileBlock& Value)
+	{
+		Ar << Value.Offset;
+		Ar << Value.CompressedSize;
+
+		return Ar;
+	}
+};
 
 struct FPackagedFileMetadata
 {
@@ -24,15 +60,97 @@ struct FPackagedFileMetadata
 	/** Size of the file. */
 	uint64 Size = 0;
 
+	/** Case insensitive hash of the path, the metadata is sorted by it. */
+	uint32 PathHash = 0;
+
+	/** Compression method of the blocks, None if the file is stored as is. */
+	ECompressionMethod CompressionMethod = ECompressionMethod::None;
+
+	/** Uncompressed size of all blocks but the last one. */
+	uint32 CompressionBlockSize = 0;
+
+	/** Blocks of a compressed file, in file order. */
+	TArray<FPackagedFileBlock> Blocks;
+
+	/** CRC32C of an uncompressed file, compressed files have a checksum per block. */
+	uint32 Checksum = 0;
+
+	/** CRC32C of each IE_PACKAGED_FILES_CHECKSUM_RANGE_SIZE range of an uncompressed file, since version 5. */
+	TArray<uint32> RangeChecksums;
+
+	// @return true if the file is stored in compressed blocks
+	FORCEINLINE bool IsCompressed() const { return CompressionMethod != ECompressionMethod::None; }
+
+	// @return Uncompressed size of a block
+	FORCEINLINE uint32 GetBlockSize(int32 BlockIndex) const
+	{
+		const uint64 blockStart = static_cast<uint64>(BlockIndex) * CompressionBlockSize;
+		return static_cast<uint32>(Size - blockStart < CompressionBlockSize ? Size - blockStart : CompressionBlockSize);
+	}
+
+	// @return true if the file and its blocks have checksums
+	FORCEINLINE bool HasChecksums() const { return Version >= 4; }
+
+	// @return true if an uncompressed file has a checksum per range instead of a single one
+	FORCEINLINE bool HasRangeChecksums() const { return Version >= 5; }
+
+	// Loading fails softly, a truncated, corrupt or newer package sets the error of the archive
 	void Serialize(FArchive& Ar)
 	{
 		Ar << Version;
+
+		if (Ar.IsLoading() && Version > IE_PACKAGED_FILE_METADATA_VERSION)
+		{
+			Ar.SetError();
+			return;
+		}
+
 		Ar << Path;
 		Ar << Offset;
 		Ar << Size;
 
-		if (Ar.IsLoading())
-			checkf(Version <= IE_PACKAGED_FILE_METADATA_VERSION, TEXT("Invalid version."));
+		if (Version >= 2)
+			Ar << PathHash;
+		else if (Ar.IsLoading())
+			PathHash = GetTypeHash(Path);
+
+		if (Version >= 3)
+		{
+			uint8 compressionMethod = static_cast<uint8>(CompressionMethod);
+			Ar << compressionMethod;
+			CompressionMethod = static_cast<ECompressionMethod>(compressionMethod);
+
+			Ar << CompressionBlockSize;
+			Ar << Blocks;
+		}
+
+		if (Version >= 4)
+		{
+			Ar << Checksum;
+
+			for (int32 i = 0; i < Blocks.Num(); ++i)
+				Ar << Blocks[i].Checksum;
+		}
+
+		if (Version >= 5)
+			Ar << RangeChecksums;
+	}
+
+	/**
+	* Converts a relative path to the form stored in the package, with forward slashes and no leading separator.
+	* @param InPath - Path to normalize.
+	* @return The normalized path.
+	*/
+	static FString NormalizePath(const FString& InPath)
+	{
+		FString path = InPath;
+		for (int32 i = 0; i < path.Length(); ++i)
+		{
+			if (path[i] == TEXT('\\'))
+				path[i] = TEXT('/');
+		}
+
+		return path.TrimStart(TEXT("/"));
 	}
 
 	friend FArchive& operator<<(FArchive& Ar, FPackagedFileMetadata& Value)
@@ -53,17 +171,22 @@ struct FPacakgedFilesMetadata
 	/** Relative path to all files */
 	TArray<FPackagedFileMetadata> Files;
 
+	// Loading fails softly, a truncated, corrupt or newer package sets the error of the archive
 	void Serialize(FArchive& Ar)
 	{
 		Ar << Version;
-		Ar << NumFiles;
-		Ar << Files;
 
-		if (Ar.IsLoading())
+		if (Ar.IsLoading() && Version > IE_PACKAGED_FILES_METADATA_VERSION)
 		{
-			checkf(Files.Num() == NumFiles, TEXT("Number of paths does not match number of files."));
-			checkf(Version <= IE_PACKAGED_FILES_METADATA_VERSION, TEXT("Invalid version."));
+			Ar.SetError();
+			return;
 		}
+
+		Ar << NumFiles;
+		Ar << Files;
+
+		if (Ar.IsLoading() && static_cast<uint32>(Files.Num()) != NumFiles)
+			Ar.SetError();
 	}
 
 	friend FArchive& operator<<(FArchive& Ar, FPacakgedFilesMetadata& Value)
@@ -73,6 +196,35 @@ struct FPacakgedFilesMetadata
 	}
 };
 
+/**
+* Fixed size record at the end of a package, locates the metadata.
+* Since version 4 the last 4 bytes of the metadata are the CRC32C of the metadata before them.
+*/
+struct FPackagedFilesFooter
+{
+	/** Size of the serialized footer in bytes. */
+	static constexpr uint64 SerializedSize = 24;
+
+	uint32 Magic = IE_PACKAGED_FILES_MAGIC;
+	uint32 Version = IE_PACKAGED_FILES_METADATA_VERSION;
+
+	/** Offset of the serialized FPacakgedFilesMetadata in the package. */
+	uint64 MetadataOffset = 0;
+
+	/** Size of the serialized FPacakgedFilesMetadata, including its checksum. */
+	uint64 MetadataSize = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FPackagedFilesFooter& Value)
+	{
+		Ar << Value.Magic;
+		Ar << Value.Version;
+		Ar << Value.MetadataOffset;
+		Ar << Value.MetadataSize;
+
+		return Ar;
+	}
+};
+
 /**
 * @brief The file manager is a high-level interface to the file system, providing a range of file operations.
 * It is intended to be a platform-independent way to access files, and should be used in preference to
@@ -102,6 +254,17 @@ public:
 	// @return true if the file was read successfully, false otherwise
 	virtual bool ReadBytes(const FString& InPath, TArray<uint8>& OutData, const FReadFileOptions& Options = FReadFileOptions()) = 0;
 
+	/**
+	* Gets read-only access to the contents of a file without copying them.
+	* Only uncompressed files of packaged builds support this, the data stays valid for the lifetime of the file manager.
+	* The data isn't verified against the checksums of the package, ReadBytes verifies the ranges it reads.
+	* @param InPath - Relative path to the file.
+	* @param OutData - Receives a pointer to the first byte of the file.
+	* @param OutSize - Receives the size of the file.
+	* @return true if the file can be accessed directly, false otherwise (use ReadBytes instead).
+	*/
+	virtual bool GetFileView(const FString& InPath, const uint8*& OutData, uint64& OutSize) { return false; }
+
 public:
 
 	/**
@@ -26,6 +26,7 @@ public:
 	static bool WriteBytes(FFileHandle Handle, const TArray<uint8>& Data);
 
 	// Read the contents of a file into a byte array
+	// Fails for more than 2 GiB, use FMappedFileHandle to access large files without copying them
 	// @param Handle - Handle to the file to read from
 	// @param OutData - Array to store the file contents in
 	// @param Options - Options for reading the file
@@ -56,6 +57,14 @@ public:
 	*/
 	static bool ReadBytesFromFile(const FString& Filename, TArray<uint8>& OutBytes, const FReadFileOptions& Options = FReadFileOptions());
 
+	/**
+	* Reads a text file into a string, the encoding is detected from the byte order mark, UTF-8 without one.
+	* @param Filename - Name of the file to read.
+	* @param OutString - String to store the text in.
+	* @return true if the file was read successfully, false otherwise.
+	*/
+	static bool ReadStringFromFile(const FString& Filename, FString& OutString);
+
 	/**
 	* Writes the contents of a byte array to a file.
 	* @param Filename - Name of the file to write.
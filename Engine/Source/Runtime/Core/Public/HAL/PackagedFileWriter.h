@@ -0,0 +1,88 @@
+#pragma once
+
+#include "HAL/FileManager.h"
+
+/**
+* Builds the package that FPackagedFileManager reads in packaged builds.
+*
+* The package holds the data of all files, each aligned to IE_PACKAGED_FILES_ALIGNMENT,
+* followed by the metadata sorted by path hash and an FPackagedFilesFooter.
+* With compression enabled, files are split into blocks that are compressed in parallel,
+* files that don't get smaller are stored as is so they can still be viewed directly.
+* Files, blocks and the metadata carry CRC32C checksums that the reader verifies.
+* Paths are relative to the game root directory, e.g. "Engine/Config/Engine.ini".
+*/
+class CORE_API FPackagedFileWriter
+{
+public:
+
+	/**
+	* Adds a file from disk, it is read when the package is written.
+	* @param InPath - Path of the file in the package.
+	* @param SourceFilename - Absolute path to the file on disk.
+	* @return true if the file was added, false if the path is empty.
+	*/
+	bool AddFile(const FString& InPath, const FString& SourceFilename);
+
+	/**
+	* Adds a file from memory.
+	* @param InPath - Path of the file in the package.
+	* @param Data - Contents of the file.
+	* @return true if the file was added, false if the path is empty.
+	*/
+	bool AddFile(const FString& InPath, TArray<uint8>&& Data);
+
+	/**
+	* Sets the compression of the files written by the following calls to Write.
+	* @param Method - Compression method, None stores the files as is.
+	* @param BlockSize - Uncompressed size of the blocks files are split into.
+	*/
+	void SetCompression(ECompressionMethod Method, uint32 BlockSize = IE_PACKAGED_FILES_COMPRESSION_BLOCK_SIZE);
+
+	/**
+	* Writes the package.
+	* @param PackageFilename - Absolute path of the package to write, an existing file is overwritten.
+	* @return true if the package was written successfully, false if a file couldn't be read or a path was added twice.
+	*/
+	bool Write(const FString& PackageFilename);
+
+	// @return Number of files added to the package
+	FORCEINLINE int32 GetNumFiles() const { return Entries.Num(); }
+
+private:
+
+	struct FEntry
+	{
+		FPackagedFileMetadata Metadata;
+
+		/** File to read the data from, empty for files added from memory. */
+		FString SourceFilename;
+
+		TArray<uint8> Data;
+	};
+
+	/**
+	* Adds a new entry for a path.
+	* @return The entry, or nullptr if the path is empty.
+	*/
+	FEntry* AddEntry(const FString& InPath);
+
+	/**
+	* Compresses the data of a file into blocks.
+	* @param Data - Contents of the file.
+	* @param OutBlocks - Receives the compressed blocks, blocks that don't get smaller are stored as is.
+	* @param OutChecksums - Receives the checksums of the blocks as stored.
+	* @return true if the compressed blocks are smaller than the file.
+	*/
+	bool CompressBlocks(const TArray<uint8>& Data, TArray<TArray<uint8>>& OutBlocks, TArray<uint32>& OutChecksums) const;
+
+	// Computes the checksum of each IE_PACKAGED_FILES_CHECKSUM_RANGE_SIZE range of an uncompressed file
+	static void ComputeRangeChecksums(const TArray<uint8>& Data, TArray<uint32>& OutChecksums);
+
+private:
+
+	TArray<FEntry> Entries;
+
+	ECompressionMethod CompressionMethod = ECompressionMethod::None;
+	uint32 CompressionBlockSize = IE_PACKAGED_FILES_COMPRESSION_BLOCK_SIZE;
+};
\ No newline at end of file
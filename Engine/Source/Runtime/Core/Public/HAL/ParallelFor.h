@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CoreModule.h"
+#include "Definitions.h"
+
+#include "Templates/Function.h"
+
+/**
+* Invokes Body for every index in [0, Num) on the calling thread and a shared pool of worker threads.
+* Returns once all indices have been processed.
+*
+* Indices are handed out one at a time, so each index should be a meaningful amount of work (e.g. one compression block).
+* While the pool is busy with another call, including a nested one, the indices are processed on the calling thread only.
+* @param Num - Number of indices.
+* @param Body - Invoked once per index, from multiple threads at the same time.
+*/
+CORE_API void ParallelFor(int32 Num, TFunctionRef<void(int32)> Body);
\ No newline at end of file
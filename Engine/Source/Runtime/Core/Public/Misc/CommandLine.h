@@ -7,6 +7,7 @@
 /**
 * Wrapper for the command line.
 * To use this class, call FCommandLine::Init() before using any of the other functions.
+* Init splits the command line into arguments once and indexes the switches and values, so Param and Value don't scan the command line.
 */
 class CORE_API FCommandLine
 {
@@ -34,9 +35,26 @@ public:
 
 	/**
 	* Gets the command line as an array of strings.
-	* String elements are separated by spaces.
+	* String elements are separated by spaces, quotes around an element are removed.
 	*/
-	static TArray<FString> GetAsArray();
+	static const TArray<FString>& GetAsArray();
+
+	/**
+	* Checks if the command line contains a switch, like -nosound or -map=Name.
+	* @param Key - The name of the switch, with or without the '-'.
+	* @param SearchCase - Whether or not to perform a case-sensitive search.
+	*/
+	static bool Param(FStringView Key, ESearchCase SearchCase = ESearchCase::CaseSensitive);
+
+	/**
+	* Gets the value of a switch, like -map=Name or map=Name.
+	* The first switch with the name that has a value is used, so -map -map=Name gives Name.
+	* @param Key - The name of the switch, with or without the '-' and '='.
+	* @param OutValue - Will hold the value, quotes around it are removed.
+	* @param SearchCase - Whether or not to perform a case-sensitive search.
+	* @return true if the switch has a value, false otherwise.
+	*/
+	static bool Value(FStringView Key, FString& OutValue, ESearchCase SearchCase = ESearchCase::CaseSensitive);
 
 private:
 
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreModule.h"
+#include "Definitions.h"
+
+enum class ECompressionMethod : uint8
+{
+	// Data is stored as is
+	None,
+
+	// LZ4 block format, fast to decompress
+	LZ4,
+
+	Count
+};
+
+/**
+* Compression of memory blocks.
+* Sizes are limited to int32, large data should be split into blocks which can also be compressed in parallel.
+*/
+class CORE_API FCompression
+{
+public:
+
+	/**
+	* Gets the maximum size of the compressed data.
+	* @param Method - The compression method.
+	* @param UncompressedSize - Size of the data to compress.
+	* @return Size the compressed buffer needs to have so compression can't fail.
+	*/
+	static int32 CompressMemoryBound(ECompressionMethod Method, int32 UncompressedSize);
+
+	/**
+	* Compresses a block of memory.
+	* @param Method - The compression method.
+	* @param CompressedBuffer - Buffer to write the compressed data to.
+	* @param InOutCompressedSize - Size of the compressed buffer, receives the size of the compressed data.
+	* @param UncompressedBuffer - Data to compress.
+	* @param UncompressedSize - Size of the data to compress.
+	* @return true if the data was compressed, false if the compressed buffer is too small.
+	*/
+	static bool CompressMemory(ECompressionMethod Method, void* CompressedBuffer, int32& InOutCompressedSize, const void* UncompressedBuffer, int32 UncompressedSize);
+
+	/**
+	* Decompresses a block of memory.
+	* Malformed compressed data is detected and never read or written out of bounds.
+	* @param Method - The compression method.
+	* @param UncompressedBuffer - Buffer to write the decompressed data to.
+	* @param UncompressedSize - Exact size of the decompressed data.
+	* @param CompressedBuffer - Data to decompress.
+	* @param CompressedSize - Size of the data to decompress.
+	* @return true if the data was decompressed, false if it is malformed.
+	*/
+	static bool UncompressMemory(ECompressionMethod Method, void* UncompressedBuffer, int32 UncompressedSize, const void* CompressedBuffer, int32 CompressedSize);
+};
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CoreModule.h"
+#include "Definitions.h"
+
+/**
+* Checksums of memory blocks.
+*/
+class CORE_API FCrc
+{
+public:
+
+	/**
+	* Computes the CRC32C (Castagnoli) checksum of a block of memory.
+	* Uses the CRC instructions of the CPU if available, otherwise a slicing-by-8 table.
+	* @param Data - Memory to compute the checksum of.
+	* @param Size - Size of the memory in bytes.
+	* @param Crc - Checksum of the preceding data, to compute the checksum of data that is split into several blocks.
+	* @return The checksum.
+	*/
+	static uint32 Crc32C(const void* Data, uint64 Size, uint32 Crc = 0);
+};
\ No newline at end of file
@@ -10,7 +10,7 @@ class CORE_API FParse final
 public:
 
 	/**
-	* Parses a string into an array of tokens.
+	* Parses a string into an array of tokens, see FTokenizer to get the tokens without copying them.
 	* @param InStr - The string to parse.
 	* @param OutTokens - Will hold the parsed tokens.
 	* @param bInAllowEmptyTokens - If true, empty tokens will be added to OutTokens.
@@ -28,7 +28,16 @@ public:
 	* @param OutValue - Will hold the parsed value.
 	* @return true if the key/value pair was parsed successfully, false otherwise.
 	*/
-	static bool KeyValue(const FString& InStr, FString& OutKey, FString& OutValue);
+	static bool KeyValue(FStringView InStr, FString& OutKey, FString& OutValue);
+
+	/**
+	* Parses a key/value pair from a string without copying it.
+	* @param InStr - The string to parse.
+	* @param OutKey - Will hold a view of the key within InStr.
+	* @param OutValue - Will hold a view of the value within InStr.
+	* @return true if the key/value pair was parsed successfully, false otherwise.
+	*/
+	static bool KeyValue(FStringView InStr, FStringView& OutKey, FStringView& OutValue);
 
 	/**
 	* Parses a value from a string.
@@ -38,13 +47,24 @@ public:
 	* @param SearchCase - Whether or not to perform a case-sensitive search.
 	* @return true if the value was parsed successfully, false otherwise.
 	*/
-	static bool Value(const FString& InStr, const FString& Key, FString& OutValue, ESearchCase SearchCase = ESearchCase::CaseSensitive);
+	static bool Value(FStringView InStr, FStringView Key, FString& OutValue, ESearchCase SearchCase = ESearchCase::CaseSensitive);
+
+	/**
+	* Parses a value from a string without copying it.
+	* @param InStr - The string to parse.
+	* @param Key - The key to look for in the string.
+	* @param OutValue - Will hold a view of the value within InStr.
+	* @param SearchCase - Whether or not to perform a case-sensitive search.
+	* @return true if the value was parsed successfully, false otherwise.
+	*/
+	static bool Value(FStringView InStr, FStringView Key, FStringView& OutValue, ESearchCase SearchCase = ESearchCase::CaseSensitive);
 
 	/**
-	* Checks if a string contains a parameter. Every parameter must start with a '-'.
+	* Checks if a string contains a parameter. Every parameter must start with a '-' and end with white-space, '=' or the end of the string.
+	* Scans the string, FCommandLine::Param looks up the parameters of the command line in its index.
 	* @param InStr - The string to check.
 	* @param Key - The key to look for in the string.
 	* @param SearchCase - Whether or not to perform a case-sensitive search.
 	*/
-	static bool Param(const FString& InStr, const FString& Key, ESearchCase SearchCase = ESearchCase::CaseSensitive);
+	static bool Param(FStringView InStr, FStringView Key, ESearchCase SearchCase = ESearchCase::CaseSensitive);
 };
\ No newline at end of file
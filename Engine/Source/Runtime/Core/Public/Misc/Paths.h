@@ -2,6 +2,11 @@
 
 #include "CoreMinimal.h"
 
+#include "Containers/StringBuilder.h"
+
+// Inline capacity of the builders paths are assembled in, longer paths spill to the heap
+#define IE_PATHS_BUILDER_SIZE 260
+
 class CORE_API FPaths
 {
 public:
@@ -13,35 +18,35 @@ public:
 	* @param bFullPath - Whether to include the full path or just the filename.
 	* @param OutPaths - Array to store the split paths in.
 	*/
-	static void Split(const FString& InPath, TArray<FString>& OutPaths, bool bFullPath = true);
+	static void Split(FStringView InPath, TArray<FString>& OutPaths, bool bFullPath = true);
 
 	/**
 	* Gets the parent directory of a path.
 	* @param InPath - Path to get the parent directory of.
 	* @return Parent directory of the path.
 	*/
-	static FString GetPathParent(const FString& InPath);
+	static FString GetPathParent(FStringView InPath);
 
 	/**
 	* Gets the filename of a path.
 	* @param InPath - Path to get the filename of.
 	* @return Filename of the path.
 	*/
-	static FString GetFilename(const FString& InPath);
+	static FString GetFilename(FStringView InPath);
 
 	/**
 	* Gets the filename without the extension of a path.
 	* @param InPath - Path to get the filename without the extension of.
 	* @return Filename without the extension of the path.
 	*/
-	static FString GetFilenameWithoutExtension(const FString& InPath);
+	static FString GetFilenameWithoutExtension(FStringView InPath);
 
 	/**
 	* Gets the file extension of a path.
 	* @param InPath - Path to get the file extension of.
 	* @return File extension of the path.
 	*/
-	static FString GetExtension(const FString& InPath);
+	static FString GetExtension(FStringView InPath);
 
 	/**
 	* Makes a path relative to the base directory.
@@ -126,10 +131,12 @@ public:
 	* @return Combined path.
 	*/
 	template<typename... Args>
-	static FString Combine(const FString& InPath, Args&&... InPaths)
+	static FString Combine(FStringView InPath, const Args&... InPaths)
 	{
-		TArray<FString> paths = { InPath, Forward<Args>(InPaths)... };
-		return Combine(paths);
+		TStringBuilder<IE_PATHS_BUILDER_SIZE> builder(InPath);
+		((builder.AppendChar(DefaultDirectorySeparator), builder.Append(FStringView(InPaths))), ...);
+
+		return builder.ToString();
 	}
 
 public:
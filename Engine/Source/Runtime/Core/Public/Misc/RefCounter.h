@@ -33,13 +33,15 @@ public:
 
 	/**
 	* Releases a shared reference to the counter.
+	* @return The number of shared references left after releasing.
 	*/
-	virtual void Release() = 0;
+	virtual int32 Release() = 0;
 
 	/**
 	* Releases a weak reference to the counter.
+	* @return The number of weak references left after releasing.
 	*/
-	virtual void ReleaseWeakRef() = 0;
+	virtual int32 ReleaseWeakRef() = 0;
 
 	/**
 	* Gets the number of shared references to the counter.
@@ -78,8 +80,8 @@ public:
 
 	void AddRef() override;
 	void AddWeakRef() override;
-	void Release() override;
-	void ReleaseWeakRef() override;
+	int32 Release() override;
+	int32 ReleaseWeakRef() override;
 	int32 GetRefCount() const override;
 	int32 GetWeakRefCount() const override;
 	bool IsThreadSafe() const override;
@@ -100,8 +102,8 @@ public:
 
 	void AddRef() override;
 	void AddWeakRef() override;
-	void Release() override;
-	void ReleaseWeakRef() override;
+	int32 Release() override;
+	int32 ReleaseWeakRef() override;
 	int32 GetRefCount() const override;
 	int32 GetWeakRefCount() const override;
 	bool IsThreadSafe() const override;
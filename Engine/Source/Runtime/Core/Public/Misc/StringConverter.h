@@ -10,6 +10,8 @@
 
 #include "Containers/Array.h"
 
+#include "Text/Transcoder.h"
+
 #define TCHAR_TO_ANSI(String) TStringConverter<TCHAR, ANSICHAR>(String)
 #define ANSI_TO_TCHAR(String) TStringConverter<ANSICHAR, TCHAR>(String)
 
@@ -24,25 +26,32 @@ struct FCanRawCastString
 	enum { Value = sizeof(Left) == sizeof(Right) };
 };
 
+// Number of characters converted without allocating
+#define STRING_CONVERTER_INLINE_CAPACITY 128
+
 /**
 * Helper class for converting between different string types
 * Converted string are only valid as long as the source string is valid
+* Strings whose conversion fits into InlineCapacity characters are converted into the converter itself, longer ones are allocated once.
 */
-template<typename Source, typename Target>
+template<typename Source, typename Target, int32 InlineCapacity = STRING_CONVERTER_INLINE_CAPACITY>
 class TStringConverter;
 
 /**
 * Helper class for converting between different string types
 * Converted string are only valid as long as the source string is valid
 */
-template<typename T>
-class TStringConverter<T, T>
+template<typename T, int32 InlineCapacity>
+class TStringConverter<T, T, InlineCapacity>
 {
 public:
 
 	TStringConverter(const T* InString)
 		: String(InString) {}
 
+	TStringConverter(const T* InString, uint32 InLength)
+		: String(InString) {}
+
 	T* Get() const
 	{
 		return const_cast<T*>(String);
@@ -55,14 +64,14 @@ private:
 
 /**
 * Helper class for converting between different string types
-* Converted string are only valid as long as the source string is valid
+* Characters of the same size are only cast, other strings are transcoded between UTF-8, UTF-16 and UTF-32 by FTranscoder.
+* Cast strings are only valid as long as the source string is valid
 */
-template<typename Source, typename Target>
+template<typename Source, typename Target, int32 InlineCapacity>
 class TStringConverter
 {
 
 	using FSourcePlatformString = TPlatformString<Source>;
-	using FTargetPlatformString = TPlatformString<Target>;
 
 public:
 
@@ -73,14 +82,41 @@ public:
 		: TStringConverter(InString, FSourcePlatformString::Strlen(InString)) {}
 
 	TStringConverter(const Source* InString, uint32 InLength)
-		: SourceString(InString), Length(InLength) {
-		Init();
+	{
+		if constexpr (FCanRawCastString<Source, Target>::Value)
+		{
+			ConvertedString = reinterpret_cast<Target*>(const_cast<Source*>(InString));
+			Length = InLength;
+		}
+		else
+		{
+			const int32 sourceLength = static_cast<int32>(InLength);
+
+			// Short strings are converted straight into the inline buffer, longer ones are counted first so they are allocated once
+			if (FTranscoder::GetMaxConvertedLength<Target, Source>(sourceLength) < InlineCapacity)
+			{
+				ConvertedString = InlineString;
+				Length = FTranscoder::Convert(ConvertedString, InlineCapacity - 1, InString, sourceLength);
+			}
+			else
+			{
+				Length = FTranscoder::GetConvertedLength<Target>(InString, sourceLength);
+				ConvertedString = Length < InlineCapacity ? InlineString : static_cast<Target*>(FMemory::Malloc((Length + 1) * sizeof(Target)));
+
+				FTranscoder::Convert(ConvertedString, Length, InString, sourceLength);
+			}
+
+			ConvertedString[Length] = (Target)'\0';
+		}
 	}
 
 	~TStringConverter()
 	{
-		if (ConvertedString)
-			FMemory::Free(ConvertedString);
+		if constexpr (!FCanRawCastString<Source, Target>::Value)
+		{
+			if (ConvertedString != InlineString)
+				FMemory::Free(ConvertedString);
+		}
 	}
 
 	TStringConverter& operator=(const TStringConverter&) = delete;
@@ -90,40 +126,18 @@ public:
 		return ConvertedString;
 	}
 
+	// @return The number of converted characters, without the null terminator
 	uint32 GetLength() const
 	{
 		return Length;
 	}
 
-	void Init()
-	{
-		if constexpr (FCanRawCastString<Source, Target>::Value)
-			ConvertedString = reinterpret_cast<Target*>(SourceString);
-		else
-		{
-			ConvertedString = (Target*)FMemory::Malloc((Length + 1) * sizeof(Target));
-
-			Target* str = ConvertedString;
-			const Target* end = ConvertedString + Length;
-
-			while (str != end)
-				*(str++) = static_cast<Target>(*(SourceString++));
-
-			ConvertedString[Length] = (Target)'\0';
-		}
-	}
-
-	void Detach()
-	{
-		ConvertedString = nullptr;
-	}
-
 private:
 
 	Target* ConvertedString = nullptr;
-
 	uint32 Length = 0;
-	const Source* SourceString;
+
+	Target InlineString[FCanRawCastString<Source, Target>::Value ? 1 : InlineCapacity];
 };
 
 // -------------------------------------------------------------------------------------------------
@@ -138,20 +152,6 @@ class CORE_API FStringCastRegistry
 {
 public:
 
-	/**
-	* Adds a string conversion to the registry
-	* @param InConverter - The string converter to add
-	*/
-	template<typename Source, typename Target>
-	static void Add(TStringConverter<Source, Target>& InConverter)
-	{
-		if (FCanRawCastString<Source, Target>::Value)
-			return; // No need to save the conversion
-
-		Add(InConverter.Get());
-		InConverter.Detach(); // Detach so the string is not freed when the converter is destroyed
-	}
-
 	/**
 	* Adds a string to the registry
 	* @param InString - The string to add
@@ -170,31 +170,34 @@ private:
 };
 
 template<typename Target, typename Source>
-Target* StringCast(const Source* InString)
+Target* StringCast(const Source* InString, uint32 InLength)
 {
-	auto converter = TStringConverter<Source, Target>(InString);
-	Target* result = converter.Get();
+	if constexpr (FCanRawCastString<Source, Target>::Value)
+	{
+		return reinterpret_cast<Target*>(const_cast<Source*>(InString));
+	}
+	else
+	{
+		// Counted first, so the string is allocated once with its exact size
+		const int32 length = FTranscoder::GetConvertedLength<Target>(InString, static_cast<int32>(InLength));
 
-	FStringCastRegistry::Add(converter);
-	return result;
+		Target* result = static_cast<Target*>(FMemory::Malloc((length + 1) * sizeof(Target)));
+		FTranscoder::Convert(result, length, InString, static_cast<int32>(InLength));
+		result[length] = (Target)'\0';
+
+		FStringCastRegistry::Add(result);
+		return result;
+	}
 }
 
 template<typename Target, typename Source>
-Target* StringCast(const Source* InString, uint32 InLength)
+Target* StringCast(const Source* InString)
 {
-	auto converter = TStringConverter<Source, Target>(InString, InLength);
-	Target* result = converter.Get();
-
-	FStringCastRegistry::Add(converter);
-	return result;
+	return StringCast<Target>(InString, TPlatformString<Source>::Strlen(InString));
 }
 
 template<typename Target>
 Target* StringCast(const FString& InString)
 {
-	auto converter = TStringConverter<TCHAR, Target>(*InString, InString.Length());
-	Target* result = converter.Get();
-
-	FStringCastRegistry::Add(converter);
-	return result;
+	return StringCast<Target>(*InString, InString.Length());
 }
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreModule.h"
+#include "Definitions.h"
+
+/**
+* Search primitives for ranges of characters, used by the string classes and the parser.
+* Scans 16 or 32 bytes at once with SSE2 or AVX2 where available, otherwise one character at a time.
+* Implemented for ANSICHAR, WIDECHAR, CHAR8, CHAR16 and CHAR32.
+* The Find functions return the index of the match or INDEX_NONE if there is none.
+*/
+class CORE_API FStringSearch
+{
+public:
+
+	// @return The index of the first occurrence of the character
+	template<typename CharType>
+	static int32 FindChar(const CharType* Data, int32 Length, CharType Char);
+
+	// @return The index of the last occurrence of the character
+	template<typename CharType>
+	static int32 FindLastChar(const CharType* Data, int32 Length, CharType Char);
+
+	/**
+	* Finds the first occurrence of a substring, case sensitive.
+	* Only positions where both the first and the last character of the substring match are compared.
+	* @return The index of the occurrence, INDEX_NONE for an empty substring
+	*/
+	template<typename CharType>
+	static int32 Find(const CharType* Data, int32 Length, const CharType* SubStr, int32 SubStrLength);
+
+	/**
+	* Finds the last occurrence of a substring, case sensitive.
+	* @return The index of the occurrence, INDEX_NONE for an empty substring
+	*/
+	template<typename CharType>
+	static int32 FindLast(const CharType* Data, int32 Length, const CharType* SubStr, int32 SubStrLength);
+
+	// @return The index of the first character that is one of the specified characters
+	template<typename CharType>
+	static int32 FindFirstOf(const CharType* Data, int32 Length, const CharType* Chars, int32 NumChars);
+
+	// @return The index of the last character that is one of the specified characters
+	template<typename CharType>
+	static int32 FindLastOf(const CharType* Data, int32 Length, const CharType* Chars, int32 NumChars);
+
+	// @return The index of the first character that is none of the specified characters
+	template<typename CharType>
+	static int32 FindFirstNotOf(const CharType* Data, int32 Length, const CharType* Chars, int32 NumChars);
+
+	// @return The index of the last character that is none of the specified characters
+	template<typename CharType>
+	static int32 FindLastNotOf(const CharType* Data, int32 Length, const CharType* Chars, int32 NumChars);
+
+	/**
+	* Compares characters ignoring case, see FCaseFolding.
+	* ASCII letters are folded a vector at a time, other characters only where the vectors still differ.
+	* @return True if the characters are equal after case folding
+	*/
+	template<typename CharType>
+	static bool EqualsIgnoreCase(const CharType* A, const CharType* B, int32 Length);
+
+	/**
+	* Compares characters ignoring the case of ASCII letters only, the folding of Strihash and GetTypeHash.
+	* Use it instead of EqualsIgnoreCase to compare strings that were found by such a hash, so equal strings always have equal hashes.
+	* @return True if the characters are equal after upper casing the ASCII letters
+	*/
+	template<typename CharType>
+	static bool EqualsIgnoreCaseAscii(const CharType* A, const CharType* B, int32 Length);
+
+	/**
+	* Converts the ASCII lower case letters to upper case a vector at a time, other characters are copied as is, like TChar::ToUpper.
+	* @param Dest - Receives Length characters, may be the same as Source
+	*/
+	template<typename CharType>
+	static void ToUpperAscii(const CharType* Source, CharType* Dest, int32 Length);
+
+	// @return The number of characters before the null terminator
+	template<typename CharType>
+	static int32 Strlen(const CharType* String);
+};
\ No newline at end of file
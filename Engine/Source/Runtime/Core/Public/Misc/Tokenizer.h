@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Definitions.h"
+
+#include "Containers/StringView.h"
+#include "Containers/StringBuilder.h"
+
+/**
+* Splits a string into tokens without allocating, the tokens are views of the source where possible.
+* Delimiters inside quotes don't split, the quotes are removed unless they are kept.
+* With an escape character, inside quotes a run of escape characters followed by a quote is halved and an odd one escapes the quote,
+* so \" is a quote character and \\" is an escape character followed by the closing quote. Other escape characters are kept as they are.
+* A token that had quotes or escapes removed from its middle is assembled in a buffer of the tokenizer and is only valid until the next token.
+*
+* Usage:
+*	for (FStringView token : FTokenizer(Command, false, false, TEXT(' ')))
+*		...
+*/
+class CORE_API FTokenizer
+{
+public:
+
+	/**
+	* @param InSource - The string to split, must outlive the tokenizer.
+	* @param bInAllowEmptyTokens - If true, empty tokens are returned too.
+	* @param bInKeepQuotes - If true, the quote characters stay part of the tokens.
+	* @param InDelim - The character that separates the tokens.
+	* @param InQuote - The quote character.
+	* @param InEscape - The character that escapes a quote or itself before a quote inside quotes, 0 for none.
+	*/
+	explicit FTokenizer(FStringView InSource, bool bInAllowEmptyTokens = false, bool bInKeepQuotes = false, TCHAR InDelim = TEXT(','), TCHAR InQuote = TEXT('\"'), TCHAR InEscape = 0);
+
+	FTokenizer(const FTokenizer&) = delete;
+	FTokenizer& operator=(const FTokenizer&) = delete;
+
+	/**
+	* Advances to the next token.
+	* @return True if there is a token, false if the end of the source was reached.
+	*/
+	bool Next();
+
+	// @return The current token, valid until the next call to Next
+	FORCEINLINE FStringView GetToken() const { return m_Token; }
+
+public:
+
+	class FIterator
+	{
+	public:
+
+		FORCEINLINE explicit FIterator(FTokenizer* InTokenizer) : m_Tokenizer(InTokenizer) {}
+
+		FORCEINLINE FStringView operator*() const { return m_Tokenizer->GetToken(); }
+
+		FORCEINLINE FIterator& operator++()
+		{
+			if (!m_Tokenizer->Next())
+				m_Tokenizer = nullptr;
+
+			return *this;
+		}
+
+		FORCEINLINE bool operator!=(const FIterator& Other) const { return m_Tokenizer != Other.m_Tokenizer; }
+
+	private:
+
+		FTokenizer* m_Tokenizer;
+	};
+
+	// Starts tokenizing, a tokenizer can be iterated once
+	FORCEINLINE FIterator begin() { return FIterator(Next() ? this : nullptr); }
+	FORCEINLINE FIterator end() { return FIterator(nullptr); }
+
+private:
+
+	// Removes the quotes and escapes of a token into the buffer
+	FStringView Unquote(FStringView InToken);
+
+	// @return Number of escape characters at the end of the characters
+	int32 CountEscapes(const TCHAR* InData, int32 InLength) const;
+
+	FStringView m_Source;
+	FStringView m_Token;
+
+	/** Index of the first character of the next token, past the end when there are no more tokens. */
+	int32 m_Position = 0;
+
+	TCHAR m_Delim;
+	TCHAR m_Quote;
+	TCHAR m_Escape;
+
+	bool m_bAllowEmptyTokens;
+	bool m_bKeepQuotes;
+
+	TStringBuilder<256> m_Buffer;
+};
\ No newline at end of file
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "Definitions.h"
+
+class CORE_API FGenericPlatformEvent
+{
+};
+
+#if PLATFORM_WINDOWS
+#include "Windows/WindowsEvent.h"
+#endif
\ No newline at end of file
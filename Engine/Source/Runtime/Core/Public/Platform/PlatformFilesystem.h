@@ -36,11 +36,26 @@ enum class ESpecialDirectory : uint8
 	AppData,
 };
 
+enum class EMappedFileAccess : uint8
+{
+	// Mapped pages are read only
+	ReadOnly,
+
+	// Mapped pages can be written to, changes are private to the process and never written back to the file
+	CopyOnWrite,
+};
+
 struct FGenericReadFileOptions
 {
 	uint64 Offset = 0;
 };
 
+struct FGenericWriteFileOptions
+{
+	// Offset to write at, MAX_uint64 writes at the current file position
+	uint64 Offset = MAX_uint64;
+};
+
 class CORE_API FGenericPlatformFilesystem
 {
 public:
@@ -2,6 +2,8 @@
 
 #include "CoreModule.h"
 #include "Misc/Char.h"
+#include "Misc/StringSearch.h"
+#include "Text/CaseFolding.h"
 #include "Math/Math.h"
 
 #include "Memory/Memory.h"
@@ -14,6 +16,8 @@
 #include <memory>
 #include <cstdarg>
 #include <string>
+#include <charconv>
+#include <cmath>
 
 enum class ESearchCase : uint8
 {
@@ -21,25 +25,8 @@ enum class ESearchCase : uint8
 	IgnoreCase
 };
 
-template<typename NumType>
-struct TFloatingPointIntegralEquivalent
-{
-	static_assert(TIsFloat<NumType>::Value, "NumType must be a floating point type");
-
-	using Type = NumType;
-};
-
-template<>
-struct TFloatingPointIntegralEquivalent<float>
-{
-	using Type = int32;
-};
-
-template<>
-struct TFloatingPointIntegralEquivalent<double>
-{
-	using Type = int64;
-};
+// Fits any float or double in fixed notation, the longest is the smallest denormal double with 343 characters
+#define FLOAT_STRING_BUFFER_SIZE 352
 
 template<typename T>
 class TPlatformString
@@ -90,11 +77,15 @@ public:
 
 	static int32 Vsnprintf(T* const Dest, int32 DestCount, const T* Format, va_list Args);
 
+	// Determines the number of characters a formatted string has, without the null terminator, or -1 if the format is invalid.
+	static int32 GetVarArgsLength(const T* Format, va_list Args);
+
 	// Helper function to compare two strings.
 	static bool Compare(const T* String1, const T* String2, ESearchCase SearchCase = ESearchCase::CaseSensitive);
 	// Helper function to compare two strings.
 	static bool Compare(const T* String1, const T* String2, int32 MinLength, ESearchCase SearchCase = ESearchCase::CaseSensitive);
 
+	// Case insensitive CRC of the characters, only ASCII letters are folded (with vectors) so the hashes stored in pak files stay valid
 	static uint32 Strihash(const T* String, int32 Length);
 
 	/**
@@ -203,13 +194,35 @@ public:
 
 public:
 
+	/**
+	* Converts a string of decimal digits with an optional sign to an integral number, eight digits at a time.
+	* @return False if the string isn't a number or the number doesn't fit into NumType, OutNumber is unchanged then.
+	*/
 	template<typename NumType>
 	static bool ToIntegral(const T* String, int32 Length, NumType& OutNumber);
+
+	/**
+	* Converts a string to the floating point number closest to it, accepts an optional sign, a fraction and an exponent.
+	* Numbers with up to 19 significant digits and a small exponent are converted directly, the rest by std::from_chars.
+	* @return False if the string isn't a number or the number is out of range, OutNumber is unchanged then.
+	*/
 	template<typename NumType>
 	static bool ToFloating(const T* String, int32 Length, NumType& OutNumber);
 
+	/**
+	* Writes an integral number in decimal, null terminated.
+	* @return False if the number doesn't fit into the buffer.
+	*/
 	template<typename NumType>
 	static bool FromIntegral(NumType Number, T* Dest, int32 DestCount);
+
+	/**
+	* Writes a floating point number in fixed notation with the shortest digits that convert back to the same number, null terminated.
+	* Whole numbers are written with one fractional digit ("3.0").
+	* @param DestCount - FLOAT_STRING_BUFFER_SIZE fits any number.
+	* @param MinFractionalDigits - Maximum number of fractional digits, rounded if there are more, all digits if 0.
+	* @return False if the number doesn't fit into the buffer.
+	*/
 	template<typename NumType>
 	static bool FromFloating(NumType Number, T* Dest, int32 DestCount, int32 MinFractionalDigits = 10);
 };
@@ -238,15 +251,7 @@ inline bool TPlatformString<T>::IsNullOrWhiteSpace(const T* String, int32 Count)
 template<typename T>
 inline int32 TPlatformString<T>::Strlen(const T* String)
 {
-	for (int32 i = 0;; ++i)
-	{
-		if (String[i] == '\0')
-			return i;
-	}
-
-	// Unreachable
-
-	return 0;
+	return FStringSearch::Strlen(String);
 }
 
 template<typename T>
@@ -288,27 +293,46 @@ inline int32 TPlatformString<T>::Strncmp(const T* String1, const T* String2, int
 template<typename T>
 inline int32 TPlatformString<T>::Stricmp(const T* String1, const T* String2)
 {
-	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	return stricmp(String1, String2);
-	PRAGMA_ENABLE_DEPRECATION_WARNINGS
+	return Strnicmp(String1, String2, TNumericLimits<int32>::Max());
 }
 
 template<typename T>
 inline int32 TPlatformString<T>::Strnicmp(const T* String1, const T* String2, int32 MaxCount)
 {
-	return strnicmp(String1, String2, MaxCount);
+	for (int32 i = 0; i < MaxCount; ++i)
+	{
+		const T char1 = FCaseFolding::Fold(String1[i]);
+		const T char2 = FCaseFolding::Fold(String2[i]);
+
+		if (char1 != char2)
+			return static_cast<std::make_unsigned_t<T>>(char1) < static_cast<std::make_unsigned_t<T>>(char2) ? -1 : 1;
+
+		if (char1 == 0)
+			break;
+	}
+
+	return 0;
 }
 
 template<typename T>
 inline int32 TPlatformString<T>::Strcmp(const T* String1, const T* String2, int32 MinLength)
 {
-	return FMemory::Memcmp(String1, String2, MinLength * sizeof(TCHAR));
+	return FMemory::Memcmp(String1, String2, MinLength * sizeof(T));
 }
 
 template<typename T>
 inline int32 TPlatformString<T>::Stricmp(const T* String1, const T* String2, int32 MinLength)
 {
-	return FMemory::Memicmp(String1, String2, MinLength * sizeof(TCHAR));
+	for (int32 i = 0; i < MinLength; ++i)
+	{
+		const T char1 = FCaseFolding::Fold(String1[i]);
+		const T char2 = FCaseFolding::Fold(String2[i]);
+
+		if (char1 != char2)
+			return static_cast<std::make_unsigned_t<T>>(char1) < static_cast<std::make_unsigned_t<T>>(char2) ? -1 : 1;
+	}
+
+	return 0;
 }
 
 template<typename T>
@@ -333,6 +357,17 @@ inline int32 TPlatformString<T>::Vsnprintf(T* const Dest, int32 DestCount, const
 		static_assert(sizeof(T) == 0, "Unsupported character type");
 }
 
+template<typename T>
+inline int32 TPlatformString<T>::GetVarArgsLength(const T* Format, va_list Args)
+{
+	if constexpr (sizeof(T) == 1)
+		return _vscprintf((const ANSICHAR*)Format, Args);
+	else if constexpr (sizeof(T) == 2)
+		return _vscwprintf((const WIDECHAR*)Format, Args);
+	else
+		static_assert(sizeof(T) == 0, "Unsupported character type");
+}
+
 template<typename T>
 inline bool TPlatformString<T>::Compare(const T* String1, const T* String2, ESearchCase SearchCase)
 {
@@ -348,7 +383,7 @@ inline bool TPlatformString<T>::Compare(const T* String1, const T* String2, int3
 	if (SearchCase == ESearchCase::CaseSensitive)
 		return Strcmp(String1, String2, MinLength) == 0;
 	else
-		return Stricmp(String1, String2, MinLength) == 0;
+		return FStringSearch::EqualsIgnoreCase(String1, String2, MinLength);
 }
 
 #pragma warning (disable : 4333)
@@ -376,14 +411,24 @@ inline uint32 TPlatformString<T>::Strihash(const T* String, int32 Length)
 		0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C, 0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4
 	};
 
+	// The letters are converted a chunk at a time with vectors, the CRC itself stays the same
+	constexpr int32 ChunkSize = 128;
+	T Upper[ChunkSize];
+
 	uint32 Hash = 0;
-	for (int32 Idx = 0; Idx < Length; ++Idx)
+	for (int32 Start = 0; Start < Length; Start += ChunkSize)
 	{
-		T Ch = TChar<T>::ToUpper(*String++);
-		uint16  B = static_cast<uint16>(Ch);
-		Hash = ((Hash >> 8) & 0x00FFFFFF) ^ CRCTable[(Hash ^ B) & 0x000000FF];
-		B = Ch >> 8;
-		Hash = ((Hash >> 8) & 0x00FFFFFF) ^ CRCTable[(Hash ^ B) & 0x000000FF];
+		const int32 Num = FMath::Min(Length - Start, ChunkSize);
+		FStringSearch::ToUpperAscii(String + Start, Upper, Num);
+
+		for (int32 Idx = 0; Idx < Num; ++Idx)
+		{
+			T Ch = Upper[Idx];
+			uint16  B = static_cast<uint16>(Ch);
+			Hash = ((Hash >> 8) & 0x00FFFFFF) ^ CRCTable[(Hash ^ B) & 0x000000FF];
+			B = Ch >> 8;
+			Hash = ((Hash >> 8) & 0x00FFFFFF) ^ CRCTable[(Hash ^ B) & 0x000000FF];
+		}
 	}
 	return Hash;
 }
@@ -531,110 +576,281 @@ inline uint32 GetTypeHash(const UTF32CHAR* String, int32 Length)
 	return FPlatformUTF32String::Strihash(String, Length);
 }
 
-template<typename T>
-template<typename NumType>
-inline bool TPlatformString<T>::ToIntegral(const T* String, int32 Length, NumType& OutNumber)
+namespace IE::Private::PlatformString
 {
-	static_assert(TIsIntegral<NumType>::Value, "NumType must be an integral type");
+	/**
+	* Packs eight characters into a word, the first character in the lowest byte.
+	* @return False if one of the characters isn't ASCII, the word is only valid for ASCII characters.
+	*/
+	template<typename T>
+	FORCEINLINE bool LoadEightChars(const T* InChars, uint64& OutWord)
+	{
+		if constexpr (sizeof(T) == 1)
+		{
+			FMemory::Memcpy(&OutWord, InChars, 8);
+			return true;
+		}
+		else
+		{
+			uint64 word = 0;
+			uint32 allBits = 0;
 
-	if (Length == 0)
-		return false;
+			for (int32 i = 0; i < 8; ++i)
+			{
+				const uint32 ch = static_cast<uint32>(InChars[i]);
+
+				allBits |= ch;
+				word |= static_cast<uint64>(ch & 0xFF) << (i * 8);
+			}
 
-	const bool bIsNegative = String[0] == '-';
-	if constexpr (TIsUnsigned<NumType>::Value)
+			OutWord = word;
+			return allBits < 0x80;
+		}
+	}
+
+	// @return True if all eight characters of the word are digits, checked at once
+	FORCEINLINE bool IsEightDigits(uint64 InWord)
 	{
-		checkf(!bIsNegative, TEXT("Cannot convert a negative string to an unsigned number"));
+		return ((InWord & 0xF0F0F0F0F0F0F0F0) | (((InWord + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
 	}
 
-	T* strPtr = bIsNegative ? (T*)String + 1 : (T*)String;
-	const T* endPtr = (const T*)String + Length;
+	// @return The value of the eight digits of the word, combining pairs, quads and octets of digits with three multiplications
+	FORCEINLINE uint32 ParseEightDigits(uint64 InWord)
+	{
+		constexpr uint64 mask = 0x000000FF000000FF;
+		constexpr uint64 mul1 = 100 + (1000000ULL << 32);
+		constexpr uint64 mul2 = 1 + (10000ULL << 32);
 
-	NumType result{};
-	while (strPtr != endPtr)
+		InWord -= 0x3030303030303030;
+		InWord = (InWord * 10) + (InWord >> 8);
+		InWord = (((InWord & mask) * mul1) + (((InWord >> 16) & mask) * mul2)) >> 32;
+
+		return static_cast<uint32>(InWord);
+	}
+
+	/**
+	* Appends decimal digits to a value, eight digits at a time while there are enough of them.
+	* @param InOutChars - Moved past the digits.
+	* @param InOutValue - Value of the preceding digits.
+	* @return False if the value doesn't fit into 64 bits.
+	*/
+	template<typename T>
+	FORCEINLINE bool ParseDigits(const T*& InOutChars, const T* InEnd, uint64& InOutValue)
 	{
-		if (!TChar<T>::IsDigit(*strPtr))
-			return false;
+		constexpr uint64 maxValueBeforeEightDigits = (TNumericLimits<uint64>::Max() - 99999999) / 100000000;
+
+		const T* chars = InOutChars;
+		uint64 value = InOutValue;
+		uint64 word;
+
+		while (InEnd - chars >= 8 && value <= maxValueBeforeEightDigits && LoadEightChars(chars, word) && IsEightDigits(word))
+		{
+			value = value * 100000000 + ParseEightDigits(word);
+			chars += 8;
+		}
+
+		bool bFits = true;
+		for (; chars != InEnd && TChar<T>::IsDigit(*chars); ++chars)
+		{
+			const uint32 digit = static_cast<uint32>(*chars - '0');
+			if (value > (TNumericLimits<uint64>::Max() - digit) / 10)
+			{
+				bFits = false;
+				break;
+			}
+
+			value = value * 10 + digit;
+		}
+
+		InOutChars = chars;
+		InOutValue = value;
 
-		result = result * 10 + (*strPtr - '0');
-		++strPtr;
+		return bFits;
 	}
 
-	if constexpr (TIsSigned<NumType>::Value)
-		OutNumber = bIsNegative ? -result : result;
-	else
-		OutNumber = result;
+	/**
+	* Converts a number with at most 19 significant digits and a small exponent, the common case of config and telemetry values.
+	* The mantissa and the power of ten are exactly representable, so the single multiplication or division rounds correctly (Clinger's fast path).
+	* @return False if the string isn't in the simple form or out of the exact range, it has to be converted by std::from_chars then.
+	*/
+	template<typename T, typename NumType>
+	FORCEINLINE bool ToFloatingFastPath(const T* InChars, const T* InEnd, NumType& OutNumber)
+	{
+		constexpr bool bDouble = sizeof(NumType) == sizeof(double);
 
-	return true;
+		// Largest mantissa without rounding and largest exactly representable power of ten
+		constexpr uint64 maxMantissa = bDouble ? (1ULL << 53) : (1ULL << 24);
+		constexpr int32 maxExponent = bDouble ? 22 : 10;
+
+		static constexpr NumType powersOfTen[] =
+		{
+			NumType(1e0), NumType(1e1), NumType(1e2), NumType(1e3), NumType(1e4), NumType(1e5), NumType(1e6), NumType(1e7),
+			NumType(1e8), NumType(1e9), NumType(1e10), NumType(1e11), NumType(1e12), NumType(1e13), NumType(1e14), NumType(1e15),
+			NumType(1e16), NumType(1e17), NumType(1e18), NumType(1e19), NumType(1e20), NumType(1e21), NumType(1e22)
+		};
+
+		const bool bIsNegative = *InChars == '-';
+		if (bIsNegative)
+			++InChars;
+
+		uint64 mantissa = 0;
+		const T* digitsStart = InChars;
+
+		if (!ParseDigits(InChars, InEnd, mantissa))
+			return false;
+
+		int32 numDigits = static_cast<int32>(InChars - digitsStart);
+		int32 exponent = 0;
+
+		if (InChars != InEnd && *InChars == '.')
+		{
+			const T* fractionStart = ++InChars;
+			if (!ParseDigits(InChars, InEnd, mantissa))
+				return false;
+
+			numDigits += static_cast<int32>(InChars - fractionStart);
+			exponent = -static_cast<int32>(InChars - fractionStart);
+		}
+
+		if (numDigits == 0)
+			return false;
+
+		if (InChars != InEnd && (*InChars == 'e' || *InChars == 'E'))
+		{
+			++InChars;
+
+			const bool bIsExponentNegative = InChars != InEnd && *InChars == '-';
+			if (InChars != InEnd && (*InChars == '-' || *InChars == '+'))
+				++InChars;
+
+			int32 explicitExponent = 0;
+			const T* exponentStart = InChars;
+
+			for (; InChars != InEnd && TChar<T>::IsDigit(*InChars) && explicitExponent < 1000; ++InChars)
+				explicitExponent = explicitExponent * 10 + (*InChars - '0');
+
+			if (InChars == exponentStart)
+				return false;
+
+			exponent += bIsExponentNegative ? -explicitExponent : explicitExponent;
+		}
+
+		if (InChars != InEnd || mantissa > maxMantissa || exponent < -maxExponent || exponent > maxExponent)
+			return false;
+
+		NumType result = static_cast<NumType>(mantissa);
+		result = exponent < 0 ? result / powersOfTen[-exponent] : result * powersOfTen[exponent];
+
+		OutNumber = bIsNegative ? -result : result;
+		return true;
+	}
 }
 
 template<typename T>
 template<typename NumType>
-inline bool TPlatformString<T>::ToFloating(const T* String, int32 Length, NumType& OutNumber)
+inline bool TPlatformString<T>::ToIntegral(const T* String, int32 Length, NumType& OutNumber)
 {
-	static_assert(TIsFloat<NumType>::Value, "NumType must be a floating point type");
+	static_assert(TIsIntegral<NumType>::Value, "NumType must be an integral type");
 
-	if (Length == 0)
+	if (Length <= 0)
 		return false;
 
-	const bool bIsNegative = String[0] == '-';
+	const T* chars = String;
+	const T* end = String + Length;
 
-	T* strPtr = bIsNegative ? (T*)String + 1 : (T*)String;
-	const T* strEndPtr = String + Length;
+	const bool bIsNegative = *chars == '-';
+	if (*chars == '-' || *chars == '+')
+		++chars;
 
-	// Find dot
+	if (chars == end)
+		return false;
 
-	int32 numberOfDigitsBeforeDot = 0;
-	typename TFloatingPointIntegralEquivalent<NumType>::Type beforeDotResult{};
+	uint64 value = 0;
+	if (!IE::Private::PlatformString::ParseDigits(chars, end, value) || chars != end)
+		return false;
 
-	while (strPtr != strEndPtr && *strPtr != '.')
+	if constexpr (TIsSigned<NumType>::Value)
 	{
-		if (!TChar<T>::IsDigit(*strPtr))
+		// The magnitude of the minimum is one larger than the maximum
+		const uint64 maxMagnitude = static_cast<uint64>(TNumericLimits<NumType>::Max()) + (bIsNegative ? 1 : 0);
+		if (value > maxMagnitude)
 			return false;
 
-		beforeDotResult = beforeDotResult * 10 + (*strPtr - '0');
-
-		++numberOfDigitsBeforeDot;
-		++strPtr;
+		OutNumber = static_cast<NumType>(bIsNegative ? 0 - value : value);
 	}
-
-	// Check if we have a dot
-
-	if (strPtr >= strEndPtr)
+	else
 	{
-		OutNumber = static_cast<NumType>(beforeDotResult);
-		return true;
+		// Negative numbers can't be stored, except for -0
+		if ((bIsNegative && value != 0) || value > static_cast<uint64>(TNumericLimits<NumType>::Max()))
+			return false;
+
+		OutNumber = static_cast<NumType>(value);
 	}
 
-	// Find digits after dot
+	return true;
+}
 
-	++strPtr;
+template<typename T>
+template<typename NumType>
+inline bool TPlatformString<T>::ToFloating(const T* String, int32 Length, NumType& OutNumber)
+{
+	static_assert(TIsFloat<NumType>::Value, "NumType must be a floating point type");
 
-	int32 numberOfDigitsAfterDot = 0;
-	typename TFloatingPointIntegralEquivalent<NumType>::Type afterDotResult{};
+	if (Length <= 0)
+		return false;
 
-	while (strPtr != strEndPtr)
+	// std::from_chars doesn't accept a plus sign
+	if (String[0] == '+')
 	{
-		if (!TChar<T>::IsDigit(*strPtr))
+		++String;
+		--Length;
+
+		if (Length == 0 || String[0] == '-')
 			return false;
+	}
+
+	if (IE::Private::PlatformString::ToFloatingFastPath(String, String + Length, OutNumber))
+		return true;
 
-		afterDotResult = afterDotResult * 10 + (*strPtr - '0');
+	// Everything else is rounded exactly by std::from_chars, which only reads chars, so other character types are narrowed first
+	const char* chars = nullptr;
+	char stackBuffer[128];
+	char* heapBuffer = nullptr;
 
-		++numberOfDigitsAfterDot;
-		++strPtr;
+	if constexpr (sizeof(T) == 1)
+	{
+		chars = reinterpret_cast<const char*>(String);
 	}
+	else
+	{
+		// Numbers are ASCII
+		for (int32 i = 0; i < Length; ++i)
+		{
+			if (static_cast<uint32>(String[i]) >= 0x80)
+				return false;
+		}
 
-	// Calculate result
+		if (Length > 128)
+			heapBuffer = static_cast<char*>(FMemory::Malloc(Length));
 
-	NumType result = static_cast<NumType>(beforeDotResult);
-	NumType afterDot = static_cast<NumType>(afterDotResult);
+		char* buffer = heapBuffer ? heapBuffer : stackBuffer;
+		for (int32 i = 0; i < Length; ++i)
+			buffer[i] = static_cast<char>(String[i]);
 
-	for (int32 i = 0; i < numberOfDigitsAfterDot; ++i)
-		afterDot /= 10;
+		chars = buffer;
+	}
 
-	result += afterDot;
-	OutNumber = bIsNegative ? -result : result;
+	NumType result{};
+	const std::from_chars_result parsed = std::from_chars(chars, chars + Length, result);
+	const bool bSuccess = parsed.ec == std::errc() && parsed.ptr == chars + Length;
 
-	return true;
+	if (heapBuffer)
+		FMemory::Free(heapBuffer);
+
+	if (bSuccess)
+		OutNumber = result;
+
+	return bSuccess;
 }
 
 template<typename T>
@@ -643,37 +859,35 @@ inline bool TPlatformString<T>::FromIntegral(NumType Number, T* Dest, int32 Dest
 {
 	static_assert(TIsIntegral<NumType>::Value, "NumType must be an integral type");
 
-	if (DestCount <= 0)
-		return false;
-
-	T* numberStart = Dest;
+	// Converted to the magnitude as unsigned, so the minimum of signed types doesn't overflow
+	uint64 magnitude = static_cast<uint64>(Number);
+	bool bIsNegative = false;
 
-	if (Number < 0)
+	if constexpr (TIsSigned<NumType>::Value)
 	{
-		*Dest = '-';
-
-		++Dest;
-		++numberStart;
-		--DestCount;
+		bIsNegative = Number < 0;
+		if (bIsNegative)
+			magnitude = 0 - magnitude;
 	}
 
-	if constexpr (TIsSigned<T>::Value)
-		Number = FMath::Abs(Number);
+	int32 numDigits = 1;
+	for (uint64 rest = magnitude / 10; rest != 0; rest /= 10)
+		++numDigits;
 
-	while (DestCount - 1 > 0 && Number > 0)
-	{
-		*Dest = '0' + Number % 10;
-		Number /= 10;
+	if (numDigits + (bIsNegative ? 1 : 0) >= DestCount)
+		return false;
 
-		++Dest;
-		--DestCount;
-	}
+	if (bIsNegative)
+		*Dest++ = '-';
 
-	if (Number > 0)
-		return false;
+	T* digit = Dest + numDigits;
+	*digit = '\0';
 
-	*Dest = '\0';
-	Reverse(numberStart, static_cast<int32>(Dest - numberStart));
+	do
+	{
+		*--digit = static_cast<T>('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude != 0);
 
 	return true;
 }
@@ -684,38 +898,44 @@ inline bool TPlatformString<T>::FromFloating(NumType Number, T* Dest, int32 Dest
 {
 	static_assert(TIsFloat<NumType>::Value, "NumType must be a floating point type");
 
-	NumType floorVal = FMath::Floor(Number);
-	NumType floatVal = Number - floorVal;
+	char buffer[FLOAT_STRING_BUFFER_SIZE];
+	char* const bufferEnd = buffer + FLOAT_STRING_BUFFER_SIZE - 2;
+
+	// The shortest digits that convert back to the same number
+	std::to_chars_result result = std::to_chars(buffer, bufferEnd, Number, std::chars_format::fixed);
+	if (result.ec != std::errc())
+		return false;
 
+	if (std::isfinite(Number))
 	{
-		NumType floatFloor;
-		do
-		{
+		const char* dot = buffer;
+		while (dot != result.ptr && *dot != '.')
+			++dot;
 
-			floatVal *= NumType(10.0);
-			floatFloor = FMath::Floor(floatVal);
+		if (dot == result.ptr)
+		{
+			// Whole numbers keep one fractional digit, so they still read as floating point numbers
+			*result.ptr++ = '.';
+			*result.ptr++ = '0';
+		}
+		else if (MinFractionalDigits > 0 && result.ptr - dot - 1 > MinFractionalDigits)
+		{
+			// Rounded to the maximum number of fractional digits, without the zeros the rounding leaves at the end
+			result = std::to_chars(buffer, bufferEnd, Number, std::chars_format::fixed, MinFractionalDigits);
+			if (result.ec != std::errc())
+				return false;
 
-		} while (floatVal > floatFloor);
+			while (result.ptr[-1] == '0' && result.ptr[-2] != '.')
+				--result.ptr;
+		}
 	}
 
-	T floorValStr[64];
-	T floatValStr[64];
-
-	if (!FromIntegral<typename TFloatingPointIntegralEquivalent<NumType>::Type>(static_cast<typename TFloatingPointIntegralEquivalent<NumType>::Type>(floorVal), floorValStr, 64))
-		return false;
-	if (!FromIntegral<typename TFloatingPointIntegralEquivalent<NumType>::Type>(static_cast<typename TFloatingPointIntegralEquivalent<NumType>::Type>(floatVal), floatValStr, 64))
-		return false;
-
-	int32 strFloorLen = Strlen(floorValStr);
-	int32 strFloatLen = Strlen(floatValStr);
-
-	int32 length = strFloorLen + (MinFractionalDigits > 0 && MinFractionalDigits < strFloatLen ? MinFractionalDigits : strFloatLen) + 1; // + 1 beacuse of the dot
-	if (DestCount + 1 < length)
+	const int32 length = static_cast<int32>(result.ptr - buffer);
+	if (length >= DestCount)
 		return false;
 
-	FMemory::Memcpy(Dest, floorValStr, static_cast<size_t>(strFloorLen) * sizeof(T));
-	Dest[strFloorLen] = '.';
-	FMemory::Memcpy(&Dest[strFloorLen + 1], floatValStr, static_cast<size_t>(MinFractionalDigits > 0 && MinFractionalDigits < strFloatLen ? MinFractionalDigits : strFloatLen) * sizeof(T));
+	for (int32 i = 0; i < length; ++i)
+		Dest[i] = static_cast<T>(buffer[i]);
 
 	Dest[length] = '\0';
 	return true;
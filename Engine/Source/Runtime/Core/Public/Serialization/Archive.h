@@ -4,6 +4,16 @@
 
 #include "Containers/Array.h"
 
+/**
+* Whether arrays of a type are serialized with a single bulk call instead of element by element.
+* Specialize it for plain structs whose operator<< serializes all of their bytes in memory order, without padding.
+*/
+template<typename T>
+struct TCanBulkSerialize
+{
+	enum { Value = IS_NUMERIC(T) };
+};
+
 class CORE_API FArchive
 {
 public:
@@ -17,6 +27,22 @@ public:
 	*/
 	virtual void Serialize(void* Data, uint64 Num) = 0;
 
+	/**
+	* Serializes an array of elements that can be copied as is.
+	* @param Data - Pointer to the first element.
+	* @param ElementSize - Size of one element in bytes.
+	* @param Num - Number of elements.
+	*/
+	virtual void SerializeBulk(void* Data, uint64 ElementSize, uint64 Num) { Serialize(Data, ElementSize * Num); }
+
+	/**
+	* Skips over data that is loaded from memory and returns a pointer to it instead of copying it.
+	* @param Num - Number of bytes to skip.
+	* @return Pointer to the data, valid as long as the memory the archive reads from,
+	* or nullptr if the archive doesn't load from memory (Serialize has to be used then, nothing is skipped).
+	*/
+	virtual const uint8* SerializeView(uint64 Num) { return nullptr; }
+
 	/**
 	* Seeks to the specified position.
 	* @param InPos - Position to seek to.
@@ -53,6 +79,25 @@ public:
 	*/
 	virtual bool IsError() = 0;
 
+	/**
+	* Marks the archive as failed, e.g. when the loaded data is malformed.
+	*/
+	virtual void SetError() = 0;
+
+	/**
+	* Serializes an unsigned integer as a LEB128 varint, 7 bits per byte, so small values take a single byte.
+	* @param Value - Value to serialize.
+	*/
+	void SerializeCompressedInt(uint64& Value);
+	void SerializeCompressedInt(uint32& Value);
+
+	/**
+	* Serializes a signed integer as a zig-zag encoded varint, so small negative values take few bytes as well.
+	* @param Value - Value to serialize.
+	*/
+	void SerializeCompressedInt(int64& Value);
+	void SerializeCompressedInt(int32& Value);
+
 	/**
 	* Returns true if this archive has reached the end of the data to read/write.
 	* @return true if this archive has reached the end of the data to read/write.
@@ -88,26 +133,69 @@ public:
 	{
 		if (Ar.IsLoading())
 		{
-			int32 num;
-
+			int32 num = 0;
 			Ar << num;
-			Array.Empty(num);
 
-			for (int32 i = 0; i < num; ++i)
+			Array.Empty();
+
+			if (Ar.IsError())
+				return Ar;
+
+			// The count comes from the data, don't allocate more elements than the remaining data can hold.
+			// Every element takes at least one byte.
+
+			const uint64 numBytes = static_cast<uint64>(num) * (TCanBulkSerialize<T>::Value ? sizeof(T) : 1);
+			const uint64 remaining = Ar.TotalSize() > Ar.Tell() ? Ar.TotalSize() - Ar.Tell() : 0;
+
+			if (num < 0 || numBytes > remaining)
 			{
-				T value;
-				Ar << value;
+				Ar.SetError();
+				return Ar;
+			}
 
-				Array.Add(MoveTemp(value));
+			if constexpr (TCanBulkSerialize<T>::Value)
+			{
+				Array.SetNumUninitialized(num);
+				if (num > 0)
+					Ar.SerializeBulk(Array.GetData(), sizeof(T), static_cast<uint64>(num));
 			}
+			else
+			{
+				// Elements may take less data than their size, so the up-front check doesn't bound the memory.
+				// Reserve what the remaining data could hold at full size and grow with the elements actually read,
+				// so a corrupt count can't allocate more than the data backs.
+
+				const uint64 numFit = remaining / sizeof(T);
+				if (num > 0)
+					Array.Reserve(static_cast<uint64>(num) < numFit ? num : (numFit > 0 ? static_cast<int32>(numFit) : 1));
+
+				for (int32 i = 0; i < num && !Ar.IsError(); ++i)
+				{
+					if (Array.Num() == Array.Capacity())
+						Array.Reserve(Array.Num());
+
+					Ar << Array[Array.Add(T())];
+				}
+			}
+
+			if (Ar.IsError())
+				Array.Empty();
 		}
 		else
 		{
 			int32 num = Array.Num();
-
 			Ar << num;
-			for (int32 i = 0; i < num; ++i)
-				Ar << Array[i];
+
+			if constexpr (TCanBulkSerialize<T>::Value)
+			{
+				if (num > 0)
+					Ar.SerializeBulk(Array.GetData(), sizeof(T), static_cast<uint64>(num));
+			}
+			else
+			{
+				for (int32 i = 0; i < num; ++i)
+					Ar << Array[i];
+			}
 		}
 
 		return Ar;
@@ -119,6 +207,7 @@ class CORE_API FMemoryArchive : public FArchive
 public:
 
 	virtual void Serialize(void* Data, uint64 Num) override;
+	virtual const uint8* SerializeView(uint64 Num) override;
 	virtual void Seek(uint64 InPos) override;
 
 	virtual uint64 Tell() override;
@@ -128,6 +217,7 @@ public:
 	virtual bool IsSaving() override;
 
 	virtual bool IsError() override;
+	virtual void SetError() override;
 	virtual bool AtEnd() override;
 	virtual void Flush() override;
 	virtual void Close() override;
@@ -135,9 +225,18 @@ public:
 protected:
 
 	FMemoryArchive(TArray<uint8>& InData, bool bInIsLoading)
-		: DataRef(InData), bIsLoading(bInIsLoading), bIsSaving(!bInIsLoading) {}
+		: DataArray(&InData), bIsLoading(bInIsLoading), bIsSaving(!bInIsLoading) {}
+
+	FMemoryArchive(const uint8* InView, uint64 InViewSize)
+		: View(InView), ViewSize(InViewSize), bIsLoading(true), bIsSaving(false) {}
+
+	// Array that is read from or written to, nullptr if the archive reads from a view
+	TArray<uint8>* DataArray = nullptr;
+
+	// Memory that is read from without copying it into an array first, e.g. a mapped file region
+	const uint8* View = nullptr;
+	uint64 ViewSize = 0;
 
-	TArray<uint8>& DataRef;
 	uint64 Pos = 0;
 
 	bool bIsLoading = false;
@@ -156,6 +255,14 @@ public:
 	FMemoryReader(TArray<uint8>& InData)
 		: FMemoryArchive(InData, true) {}
 
+	/**
+	* Reads directly from memory that is owned by someone else, e.g. an FMappedFileRegion.
+	* @param InData - Pointer to the memory to read from, has to stay valid while the reader is used.
+	* @param InSize - Number of readable bytes.
+	*/
+	FMemoryReader(const uint8* InData, uint64 InSize)
+		: FMemoryArchive(InData, InSize) {}
+
 	virtual ~FMemoryReader() = default;
 };
 
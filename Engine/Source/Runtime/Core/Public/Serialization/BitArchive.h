@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Serialization/Archive.h"
+
+/**
+* Base class of archives that serialize individual bits.
+* Bits are stored least significant bit first, bytes serialized with Serialize take 8 bits at the current bit position.
+* Positions and sizes of the FArchive interface are in bytes, rounded up.
+*/
+class CORE_API FBitArchive : public FArchive
+{
+public:
+
+	/**
+	* Serializes a number of bits.
+	* @param Data - Pointer to the bits, the first bit is the least significant bit of the first byte.
+	* @param NumBits - Number of bits to serialize.
+	*/
+	virtual void SerializeBits(void* Data, uint64 NumBits) = 0;
+
+	/**
+	* Serializes a single bit.
+	* @param bValue - Value to serialize.
+	*/
+	void SerializeBit(bool& bValue);
+
+	/**
+	* Serializes an integer in the range [0, ValueMax) with as few bits as the range needs.
+	* @param Value - Value to serialize, clamped to the range when saving.
+	* @param ValueMax - Exclusive upper bound of the value, has to be greater than 0.
+	*/
+	void SerializeInt(uint32& Value, uint32 ValueMax);
+
+	/**
+	* Serializes a float in the range [Min, Max] quantized to a number of bits.
+	* @param Value - Value to serialize, clamped to the range when saving.
+	* @param Min - Lower bound of the value.
+	* @param Max - Upper bound of the value.
+	* @param NumBits - Number of bits to quantize to, between 1 and 32.
+	*/
+	void SerializeQuantizedFloat(float& Value, float Min, float Max, uint32 NumBits);
+
+	// @return Number of bits serialized so far
+	FORCEINLINE uint64 GetPosBits() const { return PosBits; }
+
+	//~ FArchive interface
+
+	virtual void Serialize(void* Data, uint64 Num) override;
+	virtual void Seek(uint64 InPos) override;
+
+	virtual uint64 Tell() override;
+
+	virtual bool IsError() override;
+	virtual void SetError() override;
+	virtual void Flush() override;
+	virtual void Close() override;
+
+	//~ End FArchive interface
+
+protected:
+
+	uint64 PosBits = 0;
+
+	bool bIsError = false;
+};
+
+/**
+* Archive for writing bits into a buffer it owns.
+*/
+class CORE_API FBitWriter : public FBitArchive
+{
+public:
+
+	FBitWriter() = default;
+
+	virtual void SerializeBits(void* Data, uint64 NumBits) override;
+
+	// @return The written bytes, the unused bits of the last byte are zero
+	FORCEINLINE const TArray<uint8>& GetBuffer() const { return Buffer; }
+
+	// @return Number of bits written
+	FORCEINLINE uint64 GetNumBits() const { return NumBits; }
+
+	//~ FArchive interface
+
+	virtual uint64 TotalSize() override;
+
+	virtual bool IsLoading() override;
+	virtual bool IsSaving() override;
+
+	virtual bool AtEnd() override;
+
+	//~ End FArchive interface
+
+private:
+
+	TArray<uint8> Buffer;
+	uint64 NumBits = 0;
+};
+
+/**
+* Archive for reading bits from memory owned by someone else.
+*/
+class CORE_API FBitReader : public FBitArchive
+{
+public:
+
+	/**
+	* @param InData - Memory to read from, has to stay valid while the reader is used.
+	* @param InNumBits - Number of readable bits.
+	*/
+	FBitReader(const uint8* InData, uint64 InNumBits)
+		: Data(InData), NumBits(InNumBits) {}
+
+	FBitReader(const TArray<uint8>& InData)
+		: Data(InData.GetData()), NumBits(static_cast<uint64>(InData.Num()) * 8) {}
+
+	virtual void SerializeBits(void* OutData, uint64 InNumBits) override;
+
+	// @return Number of bits that haven't been read yet
+	FORCEINLINE uint64 GetBitsLeft() const { return PosBits < NumBits ? NumBits - PosBits : 0; }
+
+	//~ FArchive interface
+
+	virtual uint64 TotalSize() override;
+
+	virtual bool IsLoading() override;
+	virtual bool IsSaving() override;
+
+	virtual bool AtEnd() override;
+
+	//~ End FArchive interface
+
+private:
+
+	const uint8* Data = nullptr;
+	uint64 NumBits = 0;
+};
\ No newline at end of file
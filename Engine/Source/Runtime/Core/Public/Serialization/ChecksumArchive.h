@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Serialization/Archive.h"
+
+/**
+* Proxy archive that computes the CRC32C checksum of all data serialized through it.
+*
+* Every call is forwarded to the inner archive, the checksum covers the serialized bytes in the order they were serialized.
+* Save the checksum after the data and compare it with the checksum computed while loading to detect corrupt data.
+* Only forward seeks while loading are allowed, they read the skipped bytes so the checksum still covers them.
+*/
+class CORE_API FChecksumArchive : public FArchive
+{
+public:
+
+	/**
+	* @param InInner - Archive to forward to, has to outlive the proxy.
+	*/
+	FChecksumArchive(FArchive& InInner)
+		: Inner(InInner) {}
+
+	// @return Checksum of the data serialized so far
+	FORCEINLINE uint32 GetChecksum() const { return Checksum; }
+
+	// Restarts the checksum, e.g. at the start of a new section
+	FORCEINLINE void ResetChecksum() { Checksum = 0; }
+
+	//~ FArchive interface
+
+	virtual void Serialize(void* Data, uint64 Num) override;
+	virtual void SerializeBulk(void* Data, uint64 ElementSize, uint64 Num) override;
+	virtual const uint8* SerializeView(uint64 Num) override;
+	virtual void Seek(uint64 InPos) override;
+
+	virtual uint64 Tell() override;
+	virtual uint64 TotalSize() override;
+
+	virtual bool IsLoading() override;
+	virtual bool IsSaving() override;
+
+	virtual bool IsError() override;
+	virtual void SetError() override;
+	virtual bool AtEnd() override;
+	virtual void Flush() override;
+	virtual void Close() override;
+
+	//~ End FArchive interface
+
+private:
+
+	FArchive& Inner;
+
+	uint32 Checksum = 0;
+};
\ No newline at end of file
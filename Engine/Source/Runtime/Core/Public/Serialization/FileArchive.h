@@ -0,0 +1,179 @@
+#pragma once
+
+#include "Serialization/Archive.h"
+
+#include "HAL/AsyncFileIO.h"
+#include "HAL/Filesystem.h"
+
+/**
+* Archive for reading a file from disk without loading it into memory as a whole.
+*
+* Reads are served from an internal buffer that is refilled with the data following the current position,
+* reads that are larger than the buffer go straight to the file.
+* With async prefetch, the data following the buffer is read by FAsyncFileIO while the buffer is being consumed.
+*/
+class CORE_API FArchiveFileReader : public FArchive
+{
+public:
+
+	/** Size of the internal buffer if none is specified. */
+	static constexpr uint32 DefaultBufferSize = 64 * 1024;
+
+public:
+
+	/**
+	* Opens a file for reading.
+	* @param Filename - Absolute path to the file to read.
+	* @param InBufferSize - Size of the internal buffer.
+	* @param bInAsyncPrefetch - If true, the data following the buffer is read in the background.
+	*/
+	FArchiveFileReader(const FString& Filename, uint32 InBufferSize = DefaultBufferSize, bool bInAsyncPrefetch = false);
+	FArchiveFileReader(const FArchiveFileReader&) = delete;
+	FArchiveFileReader& operator=(const FArchiveFileReader&) = delete;
+
+	virtual ~FArchiveFileReader();
+
+	// @return true if the file was opened successfully
+	FORCEINLINE bool IsValid() const { return FFilesystem::IsFileValid(Handle); }
+
+	//~ FArchive interface
+
+	virtual void Serialize(void* Data, uint64 Num) override;
+	virtual void Seek(uint64 InPos) override;
+
+	virtual uint64 Tell() override;
+	virtual uint64 TotalSize() override;
+
+	virtual bool IsLoading() override;
+	virtual bool IsSaving() override;
+
+	virtual bool IsError() override;
+	virtual void SetError() override;
+	virtual bool AtEnd() override;
+	virtual void Flush() override;
+	virtual void Close() override;
+
+	//~ End FArchive interface
+
+private:
+
+	/**
+	* Refills the buffer with the data starting at the current position, from the prefetch if it covers the position.
+	* @return false if the file couldn't be read.
+	*/
+	bool FillBuffer();
+
+	// Starts reading the data following the buffer in the background
+	void StartPrefetch();
+
+	// Cancels the pending prefetch and waits until its buffer isn't used anymore
+	void CancelPrefetch();
+
+private:
+
+	FFileHandle Handle = nullptr;
+	uint64 FileSize = 0;
+
+	uint64 Pos = 0;
+
+	TArray<uint8> Buffer;
+
+	/** Position of the first byte in the buffer in the file. */
+	uint64 BufferStart = 0;
+
+	/** Number of valid bytes in the buffer. */
+	uint64 BufferNum = 0;
+
+	bool bAsyncPrefetch = false;
+
+	/** Buffer the prefetch reads into, swapped with the buffer once the position reaches it. */
+	TArray<uint8> PrefetchBuffer;
+
+	FAsyncReadRequestPtr PrefetchRequest;
+	uint64 PrefetchStart = 0;
+
+	bool bIsError = false;
+};
+
+/**
+* Archive for writing a file to disk without building it in memory first.
+*
+* Writes are collected in an internal buffer that is written to the file once it is full,
+* writes that are larger than the buffer go straight to the file.
+* The file is truncated when the archive is opened.
+*/
+class CORE_API FArchiveFileWriter : public FArchive
+{
+public:
+
+	/** Size of the internal buffer if none is specified. */
+	static constexpr uint32 DefaultBufferSize = 64 * 1024;
+
+public:
+
+	/**
+	* Opens a file for writing, the file and its directories are created if they don't exist.
+	* @param Filename - Absolute path to the file to write.
+	* @param InBufferSize - Size of the internal buffer.
+	*/
+	FArchiveFileWriter(const FString& Filename, uint32 InBufferSize = DefaultBufferSize);
+	FArchiveFileWriter(const FArchiveFileWriter&) = delete;
+	FArchiveFileWriter& operator=(const FArchiveFileWriter&) = delete;
+
+	virtual ~FArchiveFileWriter();
+
+	// @return true if the file was opened successfully
+	FORCEINLINE bool IsValid() const { return FFilesystem::IsFileValid(Handle); }
+
+	//~ FArchive interface
+
+	virtual void Serialize(void* Data, uint64 Num) override;
+	virtual void Seek(uint64 InPos) override;
+
+	virtual uint64 Tell() override;
+	virtual uint64 TotalSize() override;
+
+	virtual bool IsLoading() override;
+	virtual bool IsSaving() override;
+
+	virtual bool IsError() override;
+	virtual void SetError() override;
+	virtual bool AtEnd() override;
+	virtual void Flush() override;
+	virtual void Close() override;
+
+	//~ End FArchive interface
+
+private:
+
+	/**
+	* Writes the buffered data to the file.
+	* @return false if the data couldn't be written.
+	*/
+	bool FlushBuffer();
+
+	/**
+	* Writes data to the file at an offset.
+	* @return false if the data couldn't be written.
+	*/
+	bool WriteToFile(const void* Data, uint64 Num, uint64 Offset);
+
+private:
+
+	FFileHandle Handle = nullptr;
+
+	/** Size of the file without the buffered data. */
+	uint64 FileSize = 0;
+
+	uint64 Pos = 0;
+
+	TArray<uint8> Buffer;
+
+	/** Position in the file the buffered data is written to. */
+	uint64 BufferStart = 0;
+
+	/** Number of buffered bytes. */
+	uint64 BufferNum = 0;
+
+	bool bIsError = false;
+};
\ No newline at end of file
@@ -1,3 +1,314 @@
 #pragma once
 
-#include "CoreModule.h"
\ No newline at end of file
+#include "CoreModule.h"
+
+#include "Serialization/Archive.h"
+
+/**
+* Schema of a struct for FSerializer, specialize it for every struct that is serialized with FSerializer:
+*
+*	template<>
+*	struct TSerializerSchema<FPlayerState>
+*	{
+*		static constexpr uint32 Version = 2;
+*
+*		using Fields = TSerializerFields<
+*			TSerializerField<1, &FPlayerState::Name>,
+*			TSerializerField<2, &FPlayerState::Health>,
+*			TSerializerField<3, &FPlayerState::Inventory>>; // Added in version 2
+*	};
+*
+* Fields are identified by their id in the data, never reuse the id of a removed field.
+* Fields of structs with a schema are serialized with FSerializer, all other fields with their operator<<.
+*/
+template<typename T>
+struct TSerializerSchema;
+
+template<typename T>
+struct TMemberPointerTraits;
+
+template<typename InStructType, typename InFieldType>
+struct TMemberPointerTraits<InFieldType InStructType::*>
+{
+	typedef InStructType StructType;
+	typedef InFieldType FieldType;
+};
+
+/**
+* Field of a serializer schema.
+* @param InId - Id of the field in the data, greater than 0 and unique within the schema.
+* @param InMember - Pointer to the member.
+*/
+template<uint32 InId, auto InMember>
+struct TSerializerField
+{
+	static_assert(InId > 0, "Serializer field ids start at 1.");
+
+	typedef typename TMemberPointerTraits<decltype(InMember)>::StructType StructType;
+	typedef typename TMemberPointerTraits<decltype(InMember)>::FieldType FieldType;
+
+	static constexpr uint32 Id = InId;
+	static constexpr auto Member = InMember;
+};
+
+/**
+* List of the fields of a serializer schema.
+*/
+template<typename... FieldTypes>
+struct TSerializerFields
+{
+	// @return true if no two fields have the same id
+	static constexpr bool HasUniqueIds()
+	{
+		// Leading 0 so the list isn't empty for schemas without fields, 0 is no valid id
+		constexpr uint32 ids[] = { 0, FieldTypes::Id... };
+
+		for (uint32 i = 1; i <= sizeof...(FieldTypes); ++i)
+		{
+			for (uint32 j = i + 1; j <= sizeof...(FieldTypes); ++j)
+			{
+				if (ids[i] == ids[j])
+					return false;
+			}
+		}
+
+		return true;
+	}
+};
+
+template<typename T>
+inline constexpr bool THasSerializerSchema = requires { typename TSerializerSchema<T>::Fields; };
+
+/**
+* Serializes structs described by a TSerializerSchema.
+*
+* Every field is saved with its id and size as varints, followed by an end marker, so data stays loadable across versions:
+* fields that are missing in the data keep their current value, fields that are unknown to the schema are skipped.
+* Delta saves only write the fields that differ from a baseline, loading them on top of the same baseline restores the struct.
+* The code for each struct is generated from its schema at compile time.
+* Saving writes each field to a scratch buffer first so its size can precede it, the archive is never seeked while saving.
+* The buffer is reused for all fields of a struct, so it is allocated once per struct instead of once per field.
+* Loading seeks forward over fields it skips, the archive has to be byte aligned.
+*/
+class CORE_API FSerializer
+{
+public:
+
+	/**
+	* Saves a struct.
+	* @param Ar - Archive to save to.
+	* @param Value - Struct to save.
+	*/
+	template<typename T>
+	static void Save(FArchive& Ar, const T& Value)
+	{
+		SaveStruct<T>(Ar, Value, nullptr);
+	}
+
+	/**
+	* Loads a struct, fields that aren't in the data keep their value.
+	* @param Ar - Archive to load from.
+	* @param Value - Struct to load into.
+	* @param OutVersion - Optionally receives the schema version the data was saved with.
+	* @return true if the struct was loaded, false if the data is malformed.
+	*/
+	template<typename T>
+	static bool Load(FArchive& Ar, T& Value, uint32* OutVersion = nullptr)
+	{
+		LoadStruct(Ar, Value, OutVersion);
+		return !Ar.IsError();
+	}
+
+	/**
+	* Saves the fields of a struct that differ from a baseline.
+	* @param Ar - Archive to save to.
+	* @param Value - Struct to save.
+	* @param Baseline - Struct the loading side has as well.
+	*/
+	template<typename T>
+	static void SaveDelta(FArchive& Ar, const T& Value, const T& Baseline)
+	{
+		SaveStruct(Ar, Value, &Baseline);
+	}
+
+	/**
+	* Loads a struct saved with SaveDelta.
+	* @param Ar - Archive to load from.
+	* @param Value - Receives the baseline with the saved fields applied.
+	* @param Baseline - Struct the delta was saved against.
+	* @return true if the struct was loaded, false if the data is malformed.
+	*/
+	template<typename T>
+	static bool LoadDelta(FArchive& Ar, T& Value, const T& Baseline)
+	{
+		Value = Baseline;
+		return Load(Ar, Value);
+	}
+
+	/**
+	* Compares all fields of two structs.
+	* @return true if all fields are equal.
+	*/
+	template<typename T>
+	static bool Identical(const T& A, const T& B)
+	{
+		if constexpr (THasSerializerSchema<T>)
+			return IdenticalFields(A, B, static_cast<typename TSerializerSchema<T>::Fields*>(nullptr));
+		else
+			return A == B;
+	}
+
+	template<typename T, typename Allocator>
+	static bool Identical(const TArray<T, Allocator>& A, const TArray<T, Allocator>& B)
+	{
+		if (A.Num() != B.Num())
+			return false;
+
+		for (int32 i = 0; i < A.Num(); ++i)
+		{
+			if (!Identical(A[i], B[i]))
+				return false;
+		}
+
+		return true;
+	}
+
+private:
+
+	template<typename T>
+	static void SaveStruct(FArchive& Ar, const T& Value, const T* Baseline)
+	{
+		typedef TSerializerSchema<T> FSchema;
+		static_assert(FSchema::Fields::HasUniqueIds(), "Serializer field ids have to be unique.");
+
+		uint32 version = FSchema::Version;
+		Ar.SerializeCompressedInt(version);
+
+		TArray<uint8> fieldData;
+		SaveFields(Ar, fieldData, Value, Baseline, static_cast<typename FSchema::Fields*>(nullptr));
+
+		uint32 endMarker = 0;
+		Ar.SerializeCompressedInt(endMarker);
+	}
+
+	template<typename T>
+	static void LoadStruct(FArchive& Ar, T& Value, uint32* OutVersion)
+	{
+		typedef TSerializerSchema<T> FSchema;
+		static_assert(FSchema::Fields::HasUniqueIds(), "Serializer field ids have to be unique.");
+
+		uint32 version = 0;
+		Ar.SerializeCompressedInt(version);
+
+		if (OutVersion)
+			*OutVersion = version;
+
+		uint32 id = 0;
+		uint64 fieldEnd = 0;
+
+		while (ReadFieldHeader(Ar, id, fieldEnd))
+		{
+			// Fields that were removed from the schema or added by a newer version are skipped
+			LoadField(Ar, Value, id, static_cast<typename FSchema::Fields*>(nullptr));
+			EndLoadField(Ar, fieldEnd);
+		}
+	}
+
+	template<typename T, typename... FieldTypes>
+	static void SaveFields(FArchive& Ar, TArray<uint8>& FieldData, const T& Value, const T* Baseline, TSerializerFields<FieldTypes...>*)
+	{
+		(SaveField<FieldTypes>(Ar, FieldData, Value, Baseline), ...);
+	}
+
+	template<typename FieldType, typename T>
+	static void SaveField(FArchive& Ar, TArray<uint8>& FieldData, const T& Value, const T* Baseline)
+	{
+		static_assert(std::is_same_v<typename FieldType::StructType, T>, "Serializer field belongs to another struct.");
+
+		const auto& field = Value.*FieldType::Member;
+
+		if (Baseline && Identical(field, Baseline->*FieldType::Member))
+			return;
+
+		// The writer starts at the beginning and overwrites the previous field in place, the buffer never shrinks
+		FMemoryWriter fieldWriter(FieldData);
+		SerializeValue(fieldWriter, const_cast<typename FieldType::FieldType&>(field));
+
+		SaveFieldData(Ar, FieldType::Id, FieldData.GetData(), fieldWriter.Tell());
+	}
+
+	template<typename T, typename... FieldTypes>
+	static void LoadField(FArchive& Ar, T& Value, uint32 Id, TSerializerFields<FieldTypes...>*)
+	{
+		((Id == FieldTypes::Id && (SerializeValue(Ar, Value.*FieldTypes::Member), true)) || ...);
+	}
+
+	template<typename T, typename... FieldTypes>
+	static bool IdenticalFields(const T& A, const T& B, TSerializerFields<FieldTypes...>*)
+	{
+		return (Identical(A.*FieldTypes::Member, B.*FieldTypes::Member) && ...);
+	}
+
+	template<typename T>
+	static void SerializeValue(FArchive& Ar, T& Value)
+	{
+		if constexpr (THasSerializerSchema<T>)
+		{
+			if (Ar.IsLoading())
+				LoadStruct(Ar, Value, nullptr);
+			else
+				SaveStruct<T>(Ar, Value, nullptr);
+		}
+		else
+		{
+			Ar << Value;
+		}
+	}
+
+	template<typename T, typename Allocator>
+	static void SerializeValue(FArchive& Ar, TArray<T, Allocator>& Value)
+	{
+		if constexpr (THasSerializerSchema<T>)
+		{
+			int32 num = Value.Num();
+			Ar << num;
+
+			if (Ar.IsLoading())
+			{
+				// Every element takes at least its end marker
+				const uint64 remaining = Ar.TotalSize() > Ar.Tell() ? Ar.TotalSize() - Ar.Tell() : 0;
+				if (Ar.IsError() || num < 0 || static_cast<uint64>(num) > remaining)
+				{
+					Ar.SetError();
+					Value.Empty();
+
+					return;
+				}
+
+				Value.Empty();
+				Value.SetNum(num);
+			}
+
+			for (int32 i = 0; i < num && !Ar.IsError(); ++i)
+				SerializeValue(Ar, Value[i]);
+		}
+		else
+		{
+			Ar << Value;
+		}
+	}
+
+	// Writes the id and size of a field followed by its serialized data
+	static void SaveFieldData(FArchive& Ar, uint32 Id, const uint8* Data, uint64 Size);
+
+	/**
+	* Reads the header of the next field.
+	* @param OutId - Receives the id of the field.
+	* @param OutFieldEnd - Receives the position of the end of the field in the archive.
+	* @return false at the end of the struct or if the data is malformed.
+	*/
+	static bool ReadFieldHeader(FArchive& Ar, uint32& OutId, uint64& OutFieldEnd);
+
+	// Moves to the end of a loaded or skipped field
+	static void EndLoadField(FArchive& Ar, uint64 FieldEnd);
+};
\ No newline at end of file
@@ -0,0 +1,254 @@
+#pragma once
+
+#include "SharedPtr.h"
+
+#include "Platform/PlatformAtomics.h"
+
+/**
+* Shared pointer slot which can be read and replaced from multiple threads without locking.
+*
+* Uses split reference counting: The slot stores a pointer to an internal node together with
+* an external counter in the upper 16 bits of a single 64-bit word. Readers only perform a
+* fixed number of interlocked operations (Load is wait-free), writers swap the whole word.
+*
+* The node owns a thread-safe TSharedPtr, so a loaded pointer stays valid after the slot has been replaced.
+*/
+template<typename ObjectType>
+class TAtomicSharedPtr final
+{
+public:
+
+	using SharedPtrType = TSharedPtr<ObjectType, ESPMode::ThreadSafe>;
+
+private:
+
+	static_assert(sizeof(void*) <= 8, "TAtomicSharedPtr requires pointers of 64 bit or less.");
+
+	struct FNode
+	{
+		FNode(const SharedPtrType& InPtr)
+			: Ptr(InPtr) {}
+
+		/** The shared pointer published through this node. */
+		SharedPtrType Ptr;
+
+		/**
+		* Internal counter of the node.
+		* Biased while the node is installed, so that it can only reach zero after it has been retired.
+		*/
+		volatile FAtomic64 InternalCount = InstalledBias;
+	};
+
+	static constexpr int32 ExternalCountShift = 48;
+
+	static constexpr FAtomic64 ExternalCountOne = FAtomic64(1) << ExternalCountShift;
+	static constexpr FAtomic64 PointerMask = ExternalCountOne - 1;
+
+	/** External counts above this value are folded back into the node by the next reader. */
+	static constexpr FAtomic64 ExternalCountFlushThreshold = FAtomic64(1) << 14;
+
+	static constexpr FAtomic64 InstalledBias = FAtomic64(1) << 62;
+
+public:
+
+	TAtomicSharedPtr() = default;
+
+	TAtomicSharedPtr(const SharedPtrType& InPtr)
+		: Word(Pack(MakeNode(InPtr), 0)) {}
+
+	TAtomicSharedPtr(const TAtomicSharedPtr&) = delete;
+	TAtomicSharedPtr& operator=(const TAtomicSharedPtr&) = delete;
+
+	~TAtomicSharedPtr()
+	{
+		const FAtomic64 word = FPlatformAtomics::InterlockedExchange64(&Word, 0);
+		RetireNode(UnpackNode(word), UnpackExternalCount(word));
+	}
+
+public:
+
+	/**
+	* Gets a copy of the currently published shared pointer.
+	* Wait-free, never blocks on writers.
+	* @return The currently published shared pointer.
+	*/
+	SharedPtrType Load() const
+	{
+		FNode* node = AcquireNode();
+		if (!node)
+			return SharedPtrType();
+
+		SharedPtrType result = node->Ptr;
+		ReleaseNode(node);
+
+		return result;
+	}
+
+	/**
+	* Publishes a new shared pointer.
+	* @param InPtr - The shared pointer to publish.
+	*/
+	void Store(const SharedPtrType& InPtr)
+	{
+		Exchange(InPtr);
+	}
+
+	/**
+	* Publishes a new shared pointer.
+	* @param InPtr - The shared pointer to publish.
+	* @return The previously published shared pointer.
+	*/
+	SharedPtrType Exchange(const SharedPtrType& InPtr)
+	{
+		FNode* newNode = MakeNode(InPtr);
+		const FAtomic64 oldWord = FPlatformAtomics::InterlockedExchange64(&Word, Pack(newNode, 0));
+
+		FNode* oldNode = UnpackNode(oldWord);
+		if (!oldNode)
+			return SharedPtrType();
+
+		// The old node can't be freed before it is retired, so the copy is safe
+
+		SharedPtrType result = oldNode->Ptr;
+		RetireNode(oldNode, UnpackExternalCount(oldWord));
+
+		return result;
+	}
+
+	/**
+	* Publishes a new shared pointer if the currently published one points to the expected object.
+	* @param Expected - The expected shared pointer. Will hold the currently published pointer if the exchange failed.
+	* @param Desired - The shared pointer to publish.
+	* @return true if the pointer was published, false otherwise.
+	*/
+	bool CompareExchange(SharedPtrType& Expected, const SharedPtrType& Desired)
+	{
+		FNode* newNode = nullptr;
+
+		for (;;)
+		{
+			const FAtomic64 word = AcquireWord();
+			FNode* node = UnpackNode(word);
+
+			ObjectType* current = node ? node->Ptr.Get() : nullptr;
+			if (current != Expected.Get())
+			{
+				Expected = node ? node->Ptr : SharedPtrType();
+
+				ReleaseNode(node);
+				FreeNode(newNode);
+
+				return false;
+			}
+
+			if (!newNode)
+				newNode = MakeNode(Desired);
+
+			// The exchange only succeeds if no other reader touched the external count in the meantime
+
+			if (FPlatformAtomics::InterlockedCompareExchange64(&Word, Pack(newNode, 0), word) == word)
+			{
+				RetireNode(node, UnpackExternalCount(word));
+				ReleaseNode(node);
+
+				return true;
+			}
+
+			ReleaseNode(node);
+		}
+	}
+
+	/**
+	* Checks whether a non-null pointer is published.
+	* @return true if a valid pointer is published, false otherwise.
+	*/
+	bool IsValid() const
+	{
+		return Load().Get() != nullptr;
+	}
+
+private:
+
+	static FNode* MakeNode(const SharedPtrType& InPtr)
+	{
+		return InPtr ? new FNode(InPtr) : nullptr;
+	}
+
+	static void FreeNode(FNode* Node)
+	{
+		if (Node)
+			delete Node;
+	}
+
+	static FAtomic64 Pack(FNode* Node, FAtomic64 ExternalCount)
+	{
+		return static_cast<FAtomic64>(reinterpret_cast<UPTRINT>(Node)) | (ExternalCount << ExternalCountShift);
+	}
+
+	static FNode* UnpackNode(FAtomic64 InWord)
+	{
+		return reinterpret_cast<FNode*>(static_cast<UPTRINT>(InWord & PointerMask));
+	}
+
+	static FAtomic64 UnpackExternalCount(FAtomic64 InWord)
+	{
+		return static_cast<FAtomic64>(static_cast<uint64>(InWord) >> ExternalCountShift);
+	}
+
+	/**
+	* Increments the external count of the published node.
+	* @return The word including the increment.
+	*/
+	FAtomic64 AcquireWord() const
+	{
+		const FAtomic64 word = FPlatformAtomics::InterlockedAdd64(&Word, ExternalCountOne);
+
+		// Fold the external count back into the node before it overflows.
+		// A single attempt is enough, the next reader will try again if this one fails.
+		// The count is moved into the node before the word is reset, a writer that retires the word in between
+		// must not see a balance of zero while the references of the word are still in use.
+
+		const FAtomic64 externalCount = UnpackExternalCount(word);
+		FNode* node = UnpackNode(word);
+
+		if (node && externalCount >= ExternalCountFlushThreshold)
+		{
+			FPlatformAtomics::InterlockedAdd64(&node->InternalCount, externalCount);
+
+			if (FPlatformAtomics::InterlockedCompareExchange64(&Word, Pack(node, 0), word) == word)
+				return Pack(node, 0);
+
+			// This reader still holds its own reference, undoing the add can't release the node
+			FPlatformAtomics::InterlockedAdd64(&node->InternalCount, -externalCount);
+		}
+
+		return word;
+	}
+
+	FNode* AcquireNode() const
+	{
+		return UnpackNode(AcquireWord());
+	}
+
+	/**
+	* Releases a reference acquired through AcquireWord.
+	*/
+	static void ReleaseNode(FNode* Node)
+	{
+		if (Node && FPlatformAtomics::InterlockedDecrement64(&Node->InternalCount) == 0)
+			delete Node;
+	}
+
+	/**
+	* Removes the installed bias and hands the external count over to the node.
+	*/
+	static void RetireNode(FNode* Node, FAtomic64 ExternalCount)
+	{
+		if (Node && FPlatformAtomics::InterlockedAdd64(&Node->InternalCount, ExternalCount - InstalledBias) == 0)
+			delete Node;
+	}
+
+private:
+
+	mutable volatile FAtomic64 Word = 0;
+};
\ No newline at end of file
@@ -1,5 +1,13 @@
 #pragma once
 
+#include "Definitions.h"
+#include "Templates/Decay.h"
+#include "Templates/ImpulseTemplates.h"
+
+#include "Windows/WindowsDebug.h"
+
+#include <functional>
+
 template<typename Type>
 struct TIsMemberFunctionPointer;
 
@@ -89,4 +97,295 @@ consteval FuncType GetFunctor(FuncType Function) { return Function; }
 template<typename FuncType>
 consteval FuncType GetFunctor(TFunction<FuncType> Function) { return FuncType(); }
 
-#define DECL_FUNC(FunctionPtr) decltype(FunctionType(FunctionPtr))
\ No newline at end of file
+#define DECL_FUNC(FunctionPtr) decltype(FunctionType(FunctionPtr))
+
+// Default size in bytes of the inline storage of TUniqueFunction
+#ifndef IE_UNIQUE_FUNCTION_INLINE_SIZE
+	#define IE_UNIQUE_FUNCTION_INLINE_SIZE 32
+#endif
+
+namespace IE::Private::Function
+{
+	enum class EStorageOp : uint8
+	{
+		Move,
+		Destroy
+	};
+
+	template<typename FunctorType, uint32 InlineSize>
+	struct TFunctorStorage
+	{
+		// Functors which are too large, aligned stricter than the inline storage or might throw while being moved are stored on the heap
+		static constexpr bool bIsInline =
+			sizeof(FunctorType) <= InlineSize &&
+			alignof(FunctorType) <= alignof(void*) &&
+			std::is_nothrow_move_constructible_v<FunctorType>;
+
+		// Inline functors that can be relocated by copying their bytes don't need a manager function
+		static constexpr bool bNeedsManager = !bIsInline || !std::is_trivially_copyable_v<FunctorType>;
+
+		static FunctorType& Get(void* Storage)
+		{
+			if constexpr (bIsInline)
+				return *reinterpret_cast<FunctorType*>(Storage);
+			else
+				return **reinterpret_cast<FunctorType**>(Storage);
+		}
+
+		template<typename InRetValType, typename... ParamTypes>
+		static InRetValType Invoke(void* Storage, ParamTypes&&... Params)
+		{
+			// std::invoke also calls member function pointers, with the object as the first parameter
+			if constexpr (std::is_void_v<InRetValType>)
+				std::invoke(Get(Storage), Forward<ParamTypes>(Params)...);
+			else
+				return std::invoke(Get(Storage), Forward<ParamTypes>(Params)...);
+		}
+
+		static void Manage(EStorageOp Op, void* Storage, void* OtherStorage)
+		{
+			switch (Op)
+			{
+			case EStorageOp::Move:
+				if constexpr (bIsInline)
+				{
+					new (Storage) FunctorType(MoveTemp(Get(OtherStorage)));
+					Get(OtherStorage).~FunctorType();
+				}
+				else
+				{
+					*reinterpret_cast<FunctorType**>(Storage) = *reinterpret_cast<FunctorType**>(OtherStorage);
+				}
+				break;
+			case EStorageOp::Destroy:
+				if constexpr (bIsInline)
+					Get(Storage).~FunctorType();
+				else
+					delete *reinterpret_cast<FunctorType**>(Storage);
+				break;
+			}
+		}
+	};
+
+	template<typename FunctorType>
+	bool IsNullFunctor(const FunctorType& Functor)
+	{
+		if constexpr (std::is_pointer_v<FunctorType> || std::is_member_pointer_v<FunctorType>)
+			return Functor == nullptr;
+		else
+			return false;
+	}
+}
+
+template<typename FuncType, uint32 InlineSize = IE_UNIQUE_FUNCTION_INLINE_SIZE>
+class TUniqueFunction
+{
+	static_assert(sizeof(FuncType) == 0, "TUniqueFunction: Use TUniqueFunction<RetValType(ParamTypes...)>!");
+};
+
+/**
+* Move-only, type-erased callable which can hold lambdas with captures.
+*
+* Callables that fit into the inline storage are stored without any heap allocation,
+* larger ones fall back to a single allocation. Invocation goes through a plain function pointer,
+* inline callables that are trivially copyable are also moved without any indirect call.
+*/
+template<typename InRetValType, typename... ParamTypes, uint32 InlineSize>
+class TUniqueFunction<InRetValType(ParamTypes...), InlineSize>
+{
+	static_assert(InlineSize >= sizeof(void*), "TUniqueFunction: The inline storage has to be able to hold a pointer!");
+
+	using FInvoker = InRetValType(*)(void*, ParamTypes&&...);
+	using FManager = void(*)(IE::Private::Function::EStorageOp, void*, void*);
+
+	template<typename FunctorType>
+	using TStorage = IE::Private::Function::TFunctorStorage<FunctorType, InlineSize>;
+
+public:
+	// Default constructor, creates an unset function
+	TUniqueFunction() = default;
+
+	TUniqueFunction(TYPE_OF_NULLPTR) {}
+
+	// Constructor that takes any callable object
+	template<typename FunctorType, typename = typename TEnableIf<!std::is_same_v<typename TDecay<FunctorType>::Type, TUniqueFunction>>::Type>
+	TUniqueFunction(FunctorType&& InFunctor)
+	{
+		using FDecayedType = typename TDecay<FunctorType>::Type;
+		static_assert(std::is_invocable_r_v<InRetValType, FDecayedType&, ParamTypes...>, "TUniqueFunction: Callable doesn't match the function signature!");
+
+		if (IE::Private::Function::IsNullFunctor(InFunctor))
+			return;
+
+		if constexpr (TStorage<FDecayedType>::bIsInline)
+			new (Storage.Bytes) FDecayedType(Forward<FunctorType>(InFunctor));
+		else
+			*reinterpret_cast<FDecayedType**>(Storage.Bytes) = new FDecayedType(Forward<FunctorType>(InFunctor));
+
+		Invoker = &TStorage<FDecayedType>::template Invoke<InRetValType, ParamTypes...>;
+
+		if constexpr (TStorage<FDecayedType>::bNeedsManager)
+			Manager = &TStorage<FDecayedType>::Manage;
+	}
+
+	TUniqueFunction(const TUniqueFunction&) = delete;
+	TUniqueFunction& operator=(const TUniqueFunction&) = delete;
+
+	TUniqueFunction(TUniqueFunction&& Other) noexcept
+	{
+		MoveFrom(Other);
+	}
+
+	TUniqueFunction& operator=(TUniqueFunction&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Reset();
+			MoveFrom(Other);
+		}
+		return *this;
+	}
+
+	TUniqueFunction& operator=(TYPE_OF_NULLPTR)
+	{
+		Reset();
+		return *this;
+	}
+
+	~TUniqueFunction()
+	{
+		Reset();
+	}
+
+	// Invokes the stored callable
+	InRetValType operator()(ParamTypes... Params) const
+	{
+		checkf(Invoker, TEXT("TUniqueFunction: Attempting to call an unset function!"));
+		return Invoker(Storage.Bytes, Forward<ParamTypes>(Params)...);
+	}
+
+	// Returns true if a callable is stored
+	bool IsSet() const
+	{
+		return Invoker != nullptr;
+	}
+
+	explicit operator bool() const
+	{
+		return IsSet();
+	}
+
+	// Destroys the stored callable
+	void Reset()
+	{
+		if (Manager)
+			Manager(IE::Private::Function::EStorageOp::Destroy, Storage.Bytes, nullptr);
+
+		Invoker = nullptr;
+		Manager = nullptr;
+	}
+
+private:
+	void MoveFrom(TUniqueFunction& Other)
+	{
+		if (Other.Manager)
+			Other.Manager(IE::Private::Function::EStorageOp::Move, Storage.Bytes, Other.Storage.Bytes);
+		else if (Other.Invoker)
+			Storage = Other.Storage;
+
+		Invoker = Other.Invoker;
+		Manager = Other.Manager;
+
+		Other.Invoker = nullptr;
+		Other.Manager = nullptr;
+	}
+
+private:
+	struct FInlineStorage
+	{
+		alignas(void*) uint8 Bytes[InlineSize];
+	};
+
+	// Holds the callable itself or a pointer to the heap allocated callable
+	mutable FInlineStorage Storage;
+
+	FInvoker Invoker = nullptr;
+	FManager Manager = nullptr;
+};
+
+template<typename FuncType>
+class TFunctionRef
+{
+	static_assert(sizeof(FuncType) == 0, "TFunctionRef: Use TFunctionRef<RetValType(ParamTypes...)>!");
+};
+
+/**
+* Non-owning reference to any callable object.
+* Never allocates, the referenced callable has to outlive the TFunctionRef. Functions and function pointers are stored by value.
+* Meant to be used as a parameter type for callbacks that are invoked before the call returns.
+*/
+template<typename InRetValType, typename... ParamTypes>
+class TFunctionRef<InRetValType(ParamTypes...)>
+{
+	// Functions are kept as function pointers, they can't be converted to void*
+	union FCallable
+	{
+		void* Object;
+		void (*Function)();
+	};
+
+	using FInvoker = InRetValType(*)(FCallable, ParamTypes&&...);
+
+	template<typename FunctorType>
+	static constexpr bool bIsFunction = std::is_function_v<std::remove_pointer_t<FunctorType>>;
+
+public:
+	template<typename FunctorType, typename = typename TEnableIf<!std::is_same_v<typename TDecay<FunctorType>::Type, TFunctionRef>>::Type>
+	TFunctionRef(FunctorType&& InFunctor)
+		: Invoker(&Invoke<typename TRemoveReference<FunctorType>::Type>)
+	{
+		using FStoredType = typename TRemoveReference<FunctorType>::Type;
+
+		static_assert(std::is_invocable_r_v<InRetValType, FStoredType&, ParamTypes...>, "TFunctionRef: Callable doesn't match the function signature!");
+
+		// A temporary function pointer like &Function stays valid, it is copied
+		if constexpr (std::is_function_v<FStoredType>)
+			Callable.Function = reinterpret_cast<void (*)()>(&InFunctor);
+		else if constexpr (bIsFunction<FStoredType>)
+			Callable.Function = reinterpret_cast<void (*)()>(InFunctor);
+		else
+			Callable.Object = const_cast<void*>(static_cast<const void*>(&InFunctor));
+	}
+
+	TFunctionRef(const TFunctionRef&) = default;
+	TFunctionRef& operator=(const TFunctionRef&) = delete;
+
+	// Invokes the referenced callable
+	InRetValType operator()(ParamTypes... Params) const
+	{
+		return Invoker(Callable, Forward<ParamTypes>(Params)...);
+	}
+
+private:
+	template<typename FunctorType>
+	static InRetValType Invoke(FCallable InCallable, ParamTypes&&... Params)
+	{
+		if constexpr (bIsFunction<FunctorType>)
+			return InvokeCallable(reinterpret_cast<std::remove_pointer_t<FunctorType>*>(InCallable.Function), Forward<ParamTypes>(Params)...);
+		else
+			return InvokeCallable(*static_cast<FunctorType*>(InCallable.Object), Forward<ParamTypes>(Params)...);
+	}
+
+	template<typename CallableType>
+	static FORCEINLINE InRetValType InvokeCallable(CallableType&& InCallable, ParamTypes&&... Params)
+	{
+		if constexpr (std::is_void_v<InRetValType>)
+			std::invoke(Forward<CallableType>(InCallable), Forward<ParamTypes>(Params)...);
+		else
+			return std::invoke(Forward<CallableType>(InCallable), Forward<ParamTypes>(Params)...);
+	}
+
+private:
+	FCallable Callable;
+	FInvoker Invoker;
+};
\ No newline at end of file
@@ -40,7 +40,7 @@ public:
 	constexpr TTuple(const TTuple& Tuple)
 		: Base(static_cast<const TTuple<Rest...>&>(Tuple.GetBase())), Value(Tuple.Value) {}
 	constexpr TTuple(TTuple&& Tuple) noexcept
-		: Base(FMemory::Move(Tuple.GetBase())), Value(FMemory::Move(Tuple.Value)) {}
+		: Base(MoveTemp(Tuple.GetBase())), Value(MoveTemp(Tuple.Value)) {}
 
 	TTuple& operator=(const TTuple& Tuple)
 	{
@@ -51,14 +51,15 @@ public:
 	}
 	TTuple& operator=(TTuple&& Tuple) noexcept
 	{
-		Value = FMemory::Move(Tuple.Value);
-		GetBase() = FMemory::Move(Tuple.GetBase());
+		Value = MoveTemp(Tuple.Value);
+		GetBase() = MoveTemp(Tuple.GetBase());
 
 		return *this;
 	}
 
+	// Elements are taken by value and moved into place, reference elements stay references
 	constexpr TTuple(First FirstElement, Rest... _Rest)
-		: Base(_Rest...), Value(FirstElement) {}
+		: Base(Forward<Rest>(_Rest)...), Value(Forward<First>(FirstElement)) {}
 
 	static consteval bool IsEmpty() { return false; }
 	static consteval size_t Size() { return sizeof...(Rest) + 1; }
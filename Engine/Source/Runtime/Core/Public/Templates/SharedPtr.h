@@ -226,6 +226,9 @@ protected:
 			{
 				RefCounter = new RefCounterType();
 				RefCounter->AddRef();
+
+				// All shared references together hold one weak reference, released with the last shared reference
+				RefCounter->AddWeakRef();
 			}
 		}
 	}
@@ -237,11 +240,11 @@ protected:
 
 		if (RefCounter)
 		{
-			RefCounter->Release();
-			if (RefCounter->GetRefCount() == 0)
+			// Only decide on the counts returned by the release, other threads may release concurrently
+			if (RefCounter->Release() == 0)
 			{
 				delete Object;
-				if (RefCounter->GetTotalRefCount() == 0)
+				if (RefCounter->ReleaseWeakRef() == 0)
 				{
 					delete RefCounter;
 					RefCounter = nullptr;
@@ -410,8 +413,7 @@ private:
 		Object = nullptr;
 		if (RefCounter)
 		{
-			RefCounter->ReleaseWeakRef();
-			if (RefCounter->GetTotalRefCount() == 0)
+			if (RefCounter->ReleaseWeakRef() == 0)
 			{
 				delete RefCounter;
 				RefCounter = nullptr;
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreModule.h"
+#include "Definitions.h"
+
+#include <type_traits>
+
+/**
+* Unicode simple case folding (CaseFolding.txt statuses C and S, Unicode 14), used to compare strings ignoring case.
+* ASCII is folded with arithmetic, other code points with a precomputed two-stage table.
+* The encoding of a character type follows from its size, see FTranscoder: UTF-8 units only fold ASCII,
+* UTF-16 units fold the Basic Multilingual Plane and leave surrogates alone, UTF-32 units fold all code points.
+*/
+class CORE_API FCaseFolding
+{
+public:
+
+	// @return The simple case folding of a code point, the code point itself if it has none
+	static uint32 FoldCodePoint(uint32 CodePoint);
+
+	// @return The folded character
+	template<typename CharType>
+	static FORCEINLINE CharType Fold(CharType Char)
+	{
+		const uint32 unit = static_cast<uint32>(static_cast<std::make_unsigned_t<CharType>>(Char));
+
+		if (unit < 0x80)
+			return unit - 'A' < 26u ? static_cast<CharType>(unit + ('a' - 'A')) : Char;
+
+		// Simple foldings of the Basic Multilingual Plane stay in it and there are none for surrogates
+		if constexpr (sizeof(CharType) == 1)
+			return Char;
+		else
+			return static_cast<CharType>(FoldCodePoint(unit));
+	}
+
+	/**
+	* Gets the characters that fold to the same character as an ASCII character, to find the candidates of a case insensitive search.
+	* Next to the lower and upper case letter, the Kelvin sign folds to 'k' and the long s to 's'.
+	* @param OutChars - Will hold the characters.
+	* @return The number of characters, 0 if the character isn't ASCII and may have variants that aren't known without a search.
+	*/
+	template<typename CharType>
+	static int32 GetCaseVariants(CharType Char, CharType (&OutChars)[3])
+	{
+		const uint32 unit = static_cast<uint32>(static_cast<std::make_unsigned_t<CharType>>(Char));
+
+		// UTF-8 units only fold ASCII, so every other unit is only equal to itself
+		if (unit >= 0x80)
+		{
+			OutChars[0] = Char;
+			return sizeof(CharType) == 1 ? 1 : 0;
+		}
+
+		const uint32 lower = Fold(unit);
+		if (lower - 'a' >= 26u)
+		{
+			OutChars[0] = Char;
+			return 1;
+		}
+
+		OutChars[0] = static_cast<CharType>(lower);
+		OutChars[1] = static_cast<CharType>(lower - ('a' - 'A'));
+
+		if constexpr (sizeof(CharType) > 1)
+		{
+			if (lower == 'k' || lower == 's')
+			{
+				OutChars[2] = static_cast<CharType>(lower == 'k' ? 0x212A : 0x017F);
+				return 3;
+			}
+		}
+
+		return 2;
+	}
+};
\ No newline at end of file
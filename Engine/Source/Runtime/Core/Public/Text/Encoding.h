@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 
+// Unicode encodings of text, the value is the size of a code unit
 enum class EEncoding : uint8
 {
 	None = 0,
@@ -10,40 +11,90 @@ enum class EEncoding : uint8
 	UTF32 = 4
 };
 
+/**
+* Conversions between text bytes and strings.
+* UTF-16 and UTF-32 bytes are little endian unless a byte order mark says otherwise.
+* Invalid sequences are replaced with U+FFFD, see FTranscoder.
+*/
 class CORE_API FEncoding
 {
 public:
 
 	/**
-	* Makes a string from a byte array.
+	* Makes a string from a byte array, the encoding is detected from the byte order mark, UTF-8 without one.
 	* @param Bytes - The byte array to make a string from (Must not be null terminated)
 	* @return The string
 	*/
 	static FString FromBytes(const TArray<uint8>& Bytes);
 
 	/**
-	* Makes a byte array from a string.
+	* Makes a UTF-8 byte array from a string, without a byte order mark.
 	* @param String - The string to make a byte array from
 	* @return The byte array
 	*/
 	static TArray<uint8> ToBytes(const FString& String);
 
+	/**
+	* Makes a string from bytes.
+	* @param Bytes - The bytes to make a string from (Must not be null terminated)
+	* @param Encoding - The encoding of the bytes, detected from the byte order mark if None. A byte order mark is skipped.
+	* @return The string
+	*/
+	static FString FromBytes(const uint8* Bytes, int32 NumBytes, EEncoding Encoding = EEncoding::None);
+
+	/**
+	* Makes a byte array from a string, without a byte order mark.
+	* @param Encoding - The encoding of the bytes, UTF-8 if None
+	* @return The byte array
+	*/
+	static TArray<uint8> ToBytes(const FString& String, EEncoding Encoding);
+
+	/**
+	* Detects the encoding of bytes from their byte order mark.
+	* @param OutBOMSize - Size of the byte order mark in bytes, 0 if there is none.
+	* @param bOutBigEndian - Whether the UTF-16 or UTF-32 bytes are big endian.
+	* @return The encoding, None if there is no byte order mark.
+	*/
+	static EEncoding DetectEncoding(const uint8* Bytes, int32 NumBytes, int32& OutBOMSize, bool& bOutBigEndian);
+
 public:
 
 	/**
 	* Makes a string from a byte array.
 	* @param Bytes - The byte array to make a string from (Must not be null terminated)
 	* @Encoding - The encoding to use
-	* @return A pointer to the string (Must be freed via FMemory::Free)
+	* @return The string
 	*/
 	template<EEncoding Encoding>
-	static void* FromBytes(const TArray<uint8>& Bytes);
+	static FString FromBytes(const TArray<uint8>& Bytes);
+
+	/**
+	* Makes a byte array from a string.
+	* @Encoding - The encoding to use
+	* @return The byte array
+	*/
+	template<EEncoding Encoding>
+	static TArray<uint8> ToBytes(const FString& String);
+
+private:
+
+	// Converts characters straight into the string
+	template<typename CharType>
+	static FString FromChars(const CharType* Chars, int32 Length);
 };
 
 template<EEncoding Encoding>
-inline void* FEncoding::FromBytes(const TArray<uint8>& Bytes)
+inline FString FEncoding::FromBytes(const TArray<uint8>& Bytes)
+{
+	static_assert(Encoding != EEncoding::None, "Use the overload without an encoding to detect it");
+
+	return FromBytes(Bytes.GetData(), Bytes.Num(), Encoding);
+}
+
+template<EEncoding Encoding>
+inline TArray<uint8> FEncoding::ToBytes(const FString& String)
 {
-	constexpr size_t encodingSize = sizeof(uint8[static_cast<uint8>(Encoding)]);
+	static_assert(Encoding != EEncoding::None, "Encoding must be UTF8, UTF16 or UTF32");
 
-	constexpr int32 length = sizeof(encodingSize) / sizeof(uint8);
+	return ToBytes(String, Encoding);
 }
\ No newline at end of file
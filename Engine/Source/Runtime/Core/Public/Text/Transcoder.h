@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreModule.h"
+#include "Definitions.h"
+
+/**
+* Validating conversions between UTF-8, UTF-16 and UTF-32, used by the string converters and FEncoding.
+* The encoding of a character type follows from its size: ANSICHAR and CHAR8 are UTF-8, WIDECHAR and CHAR16 are UTF-16, CHAR32 is UTF-32.
+* Invalid sequences - truncated or overlong UTF-8, unpaired surrogates, code points above U+10FFFF - are replaced with U+FFFD,
+* each maximal invalid subpart with one replacement character.
+* Runs of ASCII characters are converted 16 bytes at once with SSE2 where available, otherwise one character at a time.
+* Implemented for all pairs of ANSICHAR, WIDECHAR, CHAR8, CHAR16 and CHAR32.
+*/
+class CORE_API FTranscoder
+{
+public:
+
+	// Replaces invalid sequences
+	static constexpr uint32 ReplacementChar = 0xFFFD;
+
+	/**
+	* Upper bound of the converted length, so short strings can be converted into a fixed buffer without counting first.
+	* @return The max number of target characters the source characters convert to
+	*/
+	template<typename TargetType, typename SourceType>
+	static constexpr int32 GetMaxConvertedLength(int32 SourceLength)
+	{
+		// One UTF-8 byte never becomes more than one unit, one UTF-16 unit at most three UTF-8 bytes,
+		// one code point at most four UTF-8 bytes or two UTF-16 units
+		if constexpr (sizeof(SourceType) == 1 || sizeof(TargetType) >= sizeof(SourceType))
+			return SourceLength;
+		else if constexpr (sizeof(TargetType) == 1)
+			return SourceLength * (sizeof(SourceType) == 2 ? 3 : 4);
+		else
+			return SourceLength * 2;
+	}
+
+	// @return The number of target characters the source characters convert to, without a null terminator
+	template<typename TargetType, typename SourceType>
+	static int32 GetConvertedLength(const SourceType* Source, int32 SourceLength);
+
+	/**
+	* Converts characters, the result isn't null terminated.
+	* @param DestCapacity - Max number of characters to write, stops before a character that doesn't fit completely.
+	* @return The number of characters written
+	*/
+	template<typename TargetType, typename SourceType>
+	static int32 Convert(TargetType* Dest, int32 DestCapacity, const SourceType* Source, int32 SourceLength);
+
+	// @return True if the characters are valid in their encoding, nothing would be replaced by a conversion
+	template<typename CharType>
+	static bool IsValid(const CharType* Source, int32 Length);
+};
\ No newline at end of file
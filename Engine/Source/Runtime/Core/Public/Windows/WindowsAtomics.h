@@ -140,6 +140,20 @@ public:
 	*/
 	static FAtomic64 InterlockedXor64(FAtomic64 volatile* ValuePtr, FAtomic64 Value);
 
+	/**
+	* Reads the value of an atomic variable with acquire semantics.
+	* @param ValuePtr Pointer to the atomic variable to read.
+	* @return The current value.
+	*/
+	static FAtomic AtomicRead(FAtomic volatile const* ValuePtr);
+
+	/**
+	* Reads the value of an atomic variable with acquire semantics.
+	* @param ValuePtr Pointer to the atomic variable to read.
+	* @return The current value.
+	*/
+	static FAtomic64 AtomicRead64(FAtomic64 volatile const* ValuePtr);
+
 };
 
 typedef FWindowsAtomics FPlatformAtomics;
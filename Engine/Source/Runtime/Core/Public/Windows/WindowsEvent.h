@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Platform/PlatformEvent.h"
+
+#if PLATFORM_WINDOWS
+
+/**
+* Synchronization event, threads can wait until another thread triggers it.
+*/
+class CORE_API FWindowsEvent : public FGenericPlatformEvent
+{
+public:
+
+	/**
+	* @param bManualReset - If true, the event stays triggered until Reset is called,
+	* otherwise it is reset automatically after releasing a single waiting thread.
+	*/
+	explicit FWindowsEvent(bool bManualReset = false);
+	FWindowsEvent(const FWindowsEvent&) = delete;
+	FWindowsEvent& operator=(const FWindowsEvent&) = delete;
+
+	~FWindowsEvent();
+
+	/**
+	* Triggers the event, releasing the waiting threads.
+	*/
+	void Trigger();
+
+	/**
+	* Resets the event to the untriggered state.
+	*/
+	void Reset();
+
+	/**
+	* Waits for the event to be triggered.
+	* @param WaitTime - The time to wait in milliseconds (0 means infinite).
+	* @return true if the event was triggered, false if the wait timed out.
+	*/
+	bool Wait(uint32 WaitTime = 0);
+
+private:
+
+	void* m_Event;
+};
+
+typedef FWindowsEvent FEvent;
+
+#endif
\ No newline at end of file
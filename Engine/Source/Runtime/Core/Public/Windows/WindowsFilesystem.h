@@ -65,8 +65,9 @@ public:
 	// @param Handle - Handle to the file to write to
 	// @param Data - Pointer to the data to write
 	// @param Size - Number of bytes to write
+	// @param Options - Options for writing the file
 	// @return true if the data was written successfully, false otherwise
-	static bool WriteData(FFileHandle Handle, const void* Data, uint64 Size);
+	static bool WriteData(FFileHandle Handle, const void* Data, uint64 Size, const FGenericWriteFileOptions& Options = FGenericWriteFileOptions());
 
 	// Read data from a file
 	// @param Handle - Handle to the file to read from
@@ -83,6 +84,125 @@ public:
 	static FString GetSpecialDirectory(ESpecialDirectory Directory);
 };
 
+/**
+* View of a part of a memory mapped file.
+* The view stays valid after the FWindowsMappedFileHandle it was created from has been closed and is unmapped when the region is destroyed.
+*/
+class CORE_API FWindowsMappedFileRegion
+{
+	friend class FWindowsMappedFileHandle;
+
+public:
+
+	FWindowsMappedFileRegion() = default;
+	FWindowsMappedFileRegion(FWindowsMappedFileRegion&& Other) noexcept;
+	FWindowsMappedFileRegion(const FWindowsMappedFileRegion&) = delete;
+
+	~FWindowsMappedFileRegion();
+
+	FWindowsMappedFileRegion& operator=(FWindowsMappedFileRegion&& Other) noexcept;
+	FWindowsMappedFileRegion& operator=(const FWindowsMappedFileRegion&) = delete;
+
+	// @return Pointer to the first mapped byte of the region
+	FORCEINLINE const uint8* GetData() const { return Data; }
+
+	// @return Pointer to the first mapped byte of the region, nullptr if the region wasn't mapped copy-on-write
+	FORCEINLINE uint8* GetMutableData() const { return bWritable ? const_cast<uint8*>(Data) : nullptr; }
+
+	// @return Number of mapped bytes
+	FORCEINLINE uint64 GetSize() const { return Size; }
+
+	// @return Offset of the region in the file
+	FORCEINLINE uint64 GetOffset() const { return Offset; }
+
+	// @return true if the region is mapped, false otherwise
+	FORCEINLINE bool IsValid() const { return Data != nullptr; }
+
+	/**
+	* Asks the system to load a range of the region into memory ahead of time.
+	* @param InOffset - Offset of the range relative to the start of the region
+	* @param InSize - Number of bytes to prefetch, 0 prefetches up to the end of the region
+	* @return true if the prefetch was issued, false otherwise
+	*/
+	bool Prefetch(uint64 InOffset = 0, uint64 InSize = 0) const;
+
+	/**
+	* Unmaps the region.
+	*/
+	void Unmap();
+
+private:
+
+	// Start of the view, aligned to the allocation granularity
+	void* MappedBase = nullptr;
+
+	const uint8* Data = nullptr;
+	uint64 Size = 0;
+	uint64 Offset = 0;
+
+	bool bWritable = false;
+};
+
+/**
+* File opened for memory mapping.
+* Any number of regions can be mapped from the same handle, files larger than 4 GiB are supported.
+*/
+class CORE_API FWindowsMappedFileHandle
+{
+public:
+
+	FWindowsMappedFileHandle() = default;
+	FWindowsMappedFileHandle(const FWindowsMappedFileHandle&) = delete;
+	FWindowsMappedFileHandle& operator=(const FWindowsMappedFileHandle&) = delete;
+
+	~FWindowsMappedFileHandle();
+
+	/**
+	* Opens a file for mapping.
+	* @param Filename - Name of the file to open
+	* @param InAccess - Access of the regions mapped from this file
+	* @return true if the file was opened successfully, false otherwise
+	*/
+	bool Open(const FString& Filename, EMappedFileAccess InAccess = EMappedFileAccess::ReadOnly);
+
+	/**
+	* Closes the file, regions that are still mapped stay valid.
+	*/
+	void Close();
+
+	/**
+	* Maps a region of the file into memory.
+	* The offset doesn't need to be aligned, the view is aligned internally.
+	* @param OutRegion - Region to map
+	* @param InOffset - Offset of the region in the file
+	* @param InSize - Number of bytes to map, 0 maps up to the end of the file
+	* @return true if the region was mapped successfully, false otherwise
+	*/
+	bool MapRegion(FWindowsMappedFileRegion& OutRegion, uint64 InOffset = 0, uint64 InSize = 0) const;
+
+	// @return true if the file is open, false otherwise
+	FORCEINLINE bool IsOpen() const { return FileHandle != nullptr; }
+
+	// @return Size of the file in bytes
+	FORCEINLINE uint64 GetFileSize() const { return FileSize; }
+
+	// @return Access of the regions mapped from this file
+	FORCEINLINE EMappedFileAccess GetAccess() const { return Access; }
+
+	// @return Alignment of the start of mapped views (allocation granularity)
+	static uint64 GetMappingAlignment();
+
+private:
+
+	FFileHandle FileHandle = nullptr;
+	void* MappingHandle = nullptr;
+
+	uint64 FileSize = 0;
+	EMappedFileAccess Access = EMappedFileAccess::ReadOnly;
+};
+
 typedef FWindowsFilesystem FPlatformFilesystem;
+typedef FWindowsMappedFileHandle FMappedFileHandle;
+typedef FWindowsMappedFileRegion FMappedFileRegion;
 
 #endif
\ No newline at end of file
@@ -79,6 +79,12 @@ public:
 	*/
 	static double Seconds();
 
+	/**
+	* Gets the number of logical processors.
+	* @return Number of logical processors, at least 1.
+	*/
+	static int32 NumberOfCores();
+
 	/**
 	* WINDOWS ONLY!
 	* Initializes COM.
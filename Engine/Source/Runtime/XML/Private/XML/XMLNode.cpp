@@ -1,13 +1,13 @@
 #include "XML/XMLNode.h"
 
 // NOT TESTED YET!
-bool CompareXMLQueryString_WithWildcards(const FString& String, const FString& CompareWith, bool bCaseInsensitive)
+bool CompareXMLQueryString_WithWildcards(FStringView String, FStringView CompareWith, bool bCaseInsensitive)
 {
 	const bool bIgnoreBefore = CompareWith[0] == TEXT('%');
 	const bool bIgnoreAfter = CompareWith[CompareWith.Length() - 1] == TEXT('%');
 	const bool bIgnoreAny = bIgnoreBefore || bIgnoreAfter;
 
-	FString compareString = CompareWith;
+	FStringView compareString = CompareWith;
 
 	if (bIgnoreBefore)
 		compareString = compareString.Right(1);
@@ -82,9 +82,10 @@ bool CompareXMLQueryString_WithWildcards(const FString& String, const FString& C
 	return compareIndex == compareLength;
 }
 
-bool CompareXMLQueryStrings(const FString& String, const FString& CompareWith, int32 Flags)
+bool CompareXMLQueryStrings(FStringView String, FStringView CompareWith, int32 Flags)
 {
-	FString compareString = CompareWith.Trim();
+	// Trimming the view doesn't copy the query
+	const FStringView compareString = CompareWith.Trim();
 	if(compareString.IsEmpty())
 		return false; // Empty string is not a valid query.
 
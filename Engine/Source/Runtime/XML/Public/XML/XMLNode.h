@@ -28,7 +28,8 @@ enum EXMLQueryFlags : int32
 
 struct FXMLAttribute
 {
-	FString Name;
+	// Interned, attribute names repeat across every node of a document
+	FInternedString Name;
 	FString Value;
 };
 
@@ -53,13 +54,13 @@ public:
 	* Gets the name of the node.
 	* @return The name of the node.
 	*/
-	inline FString GetName() const { return Name; }
+	inline const FSharedString& GetName() const { return Name; }
 
 	/**
 	* Gets the inner text of the node.
 	* @return The inner text of the node.
 	*/
-	inline FString GetInner() const { return Inner; }
+	inline const FSharedString& GetInner() const { return Inner; }
 
 	/**
 	* Gets the parent node of the node.
@@ -109,8 +110,9 @@ public:
 
 private:
 
-	FString Name;
-	FString Inner;
+	// Shared, copies of nodes and the strings returned by the getters don't copy the characters
+	FSharedString Name;
+	FSharedString Inner;
 	TArray<FXMLAttribute> Attributes;
 	TArray<FXMLNodePtr> Children;
 	FWeakXMLNodePtr Parent;